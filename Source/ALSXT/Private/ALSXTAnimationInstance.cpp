@@ -52,27 +52,9 @@ void UALSXTAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 		return;
 	}
 
-	Freelooking = ALSXTCharacter->GetDesiredFreelooking();
-	Sex = ALSXTCharacter->GetDesiredSex();
-	DefensiveMode = ALSXTCharacter->GetDesiredDefensiveMode();
-	LocomotionVariant = ALSXTCharacter->GetDesiredLocomotionVariant();
-	Injury = ALSXTCharacter->GetDesiredInjury();
-	CombatStance = ALSXTCharacter->GetDesiredCombatStance();
-	WeaponFirearmStance = ALSXTCharacter->GetDesiredWeaponFirearmStance();
-	WeaponReadyPosition = ALSXTCharacter->GetDesiredWeaponReadyPosition();
-	StationaryMode = ALSXTCharacter->GetStationaryMode();
-	HoldingBreath = ALSXTCharacter->GetHoldingBreath();
-	PhysicalAnimationMode = ALSXTCharacter->GetPhysicalAnimationMode();
-	Gesture = ALSXTCharacter->GetGesture();
-	GestureHand = ALSXTCharacter->GetGestureHand();
-	ReloadingType = ALSXTCharacter->GetReloadingType();
-	ForegripPosition = ALSXTCharacter->GetDesiredForegripPosition();
-	FirearmFingerAction = ALSXTCharacter->GetFirearmFingerAction();
-	FirearmFingerActionHand = ALSXTCharacter->GetFirearmFingerActionHand();
-	WeaponCarryPosition = ALSXTCharacter->GetWeaponCarryPosition();
-	FirearmSightLocation = ALSXTCharacter->GetFirearmSightLocation();
+	RefreshAnimationStateSnapshot();
+
 	ForegripTransform = ALSXTCharacter->GetCurrentForegripTransform();
-	VaultType = ALSXTCharacter->GetVaultType();
 	AimState = ALSXTCharacter->GetAimState();
 	FreelookState = ALSXTCharacter->GetFreelookState();
 	DoesOverlayObjectUseLeftHandIK = ALSXTCharacter->DoesOverlayObjectUseLeftHandIK();
@@ -90,8 +72,41 @@ void UALSXTAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 	}
 
 	DefensiveModeState = ALSXTCharacter->GetDefensiveModeState();
-	WeaponObstruction = ALSXTCharacter->GetWeaponObstruction();
-	BreathState.HoldingBreath = ALSXTCharacter->GetDesiredHoldingBreath();
+}
+
+void UALSXTAnimationInstance::RefreshAnimationStateSnapshot()
+{
+	const auto& Snapshot{ALSXTCharacter->GetAnimationStateSnapshot()};
+
+	if (Snapshot.Version == AnimationStateSnapshotVersion)
+	{
+		return;
+	}
+
+	AnimationStateSnapshotVersion = Snapshot.Version;
+
+	Freelooking = Snapshot.Freelooking;
+	Sex = Snapshot.Sex;
+	DefensiveMode = Snapshot.DefensiveMode;
+	LocomotionVariant = Snapshot.LocomotionVariant;
+	Injury = Snapshot.Injury;
+	CombatStance = Snapshot.CombatStance;
+	WeaponFirearmStance = Snapshot.WeaponFirearmStance;
+	WeaponReadyPosition = Snapshot.WeaponReadyPosition;
+	StationaryMode = Snapshot.StationaryMode;
+	HoldingBreath = Snapshot.HoldingBreath;
+	PhysicalAnimationMode = Snapshot.PhysicalAnimationMode;
+	Gesture = Snapshot.Gesture;
+	GestureHand = Snapshot.GestureHand;
+	ReloadingType = Snapshot.ReloadingType;
+	ForegripPosition = Snapshot.ForegripPosition;
+	FirearmFingerAction = Snapshot.FirearmFingerAction;
+	FirearmFingerActionHand = Snapshot.FirearmFingerActionHand;
+	WeaponCarryPosition = Snapshot.WeaponCarryPosition;
+	FirearmSightLocation = Snapshot.FirearmSightLocation;
+	VaultType = Snapshot.VaultType;
+	WeaponObstruction = Snapshot.WeaponObstruction;
+	BreathState.HoldingBreath = Snapshot.DesiredHoldingBreath;
 }
 
 void UALSXTAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTime)
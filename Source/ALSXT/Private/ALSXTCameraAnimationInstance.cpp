@@ -6,11 +6,9 @@
 #include "AlsCharacter.h"
 #include "ALSXTCharacter.h"
 
-void UALSXTCameraAnimationInstance::NativeBeginPlay()
+namespace ALSXTCameraAnimationInstanceConstants
 {
-	Super::NativeBeginPlay();
-	// Call RepeatingFunction once per second, starting two seconds from now.
-	GetWorld()->GetTimerManager().SetTimer(FirstPersonOverrideHandle, this, &UALSXTCameraAnimationInstance::OnFirstPersonOverrideChangedEvent, 0.01f, true, 0.0f);
+	static const FName FirstPersonOverrideCurveName{TEXT("FirstPersonOverride")};
 }
 
 void UALSXTCameraAnimationInstance::NativeInitializeAnimation()
@@ -47,26 +45,34 @@ void UALSXTCameraAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 		return;
 	}
 
-	Overlay = ALSXTCharacter->GetOverlayMode();
-	Freelooking = ALSXTCharacter->GetDesiredFreelooking();
-	Sex = ALSXTCharacter->GetDesiredSex();
-	LocomotionVariant = ALSXTCharacter->GetDesiredLocomotionVariant();
-	Injury = ALSXTCharacter->GetDesiredInjury();
-	CombatStance = ALSXTCharacter->GetDesiredCombatStance();
-	WeaponFirearmStance = ALSXTCharacter->GetDesiredWeaponFirearmStance();
-	WeaponReadyPosition = ALSXTCharacter->GetDesiredWeaponReadyPosition();
+	OnFirstPersonOverrideChangedEvent();
+
+	const auto& Snapshot{ALSXTCharacter->GetAnimationStateSnapshot()};
+
+	if (Snapshot.Version == AnimationStateSnapshotVersion)
+	{
+		return;
+	}
+
+	AnimationStateSnapshotVersion = Snapshot.Version;
+
+	Overlay = Snapshot.Overlay;
+	Freelooking = Snapshot.Freelooking;
+	Sex = Snapshot.Sex;
+	LocomotionVariant = Snapshot.LocomotionVariant;
+	Injury = Snapshot.Injury;
+	CombatStance = Snapshot.CombatStance;
+	WeaponFirearmStance = Snapshot.WeaponFirearmStance;
+	WeaponReadyPosition = Snapshot.WeaponReadyPosition;
 }
 
 void UALSXTCameraAnimationInstance::OnFirstPersonOverrideChangedEvent()
 {
-	FirstPersonOverride = GetCurveValue("FirstPersonOverride");
-	if (FirstPersonOverride != PreviousFirstPersonOverride)
-	{
-		OnFirstPersonOverrideChanged.Broadcast(GetCurveValue("FirstPersonOverride"));
-		PreviousFirstPersonOverride = GetCurveValue("FirstPersonOverride");
-	}
-	else
+	const auto NewFirstPersonOverride{GetCurveValue(ALSXTCameraAnimationInstanceConstants::FirstPersonOverrideCurveName)};
+
+	if (NewFirstPersonOverride != FirstPersonOverride)
 	{
-		PreviousFirstPersonOverride = GetCurveValue("FirstPersonOverride");
+		FirstPersonOverride = NewFirstPersonOverride;
+		OnFirstPersonOverrideChanged.Broadcast(FirstPersonOverride);
 	}
 }
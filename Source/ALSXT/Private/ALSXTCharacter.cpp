@@ -10,6 +10,7 @@
 #include "GameFramework/Pawn.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameStateBase.h"
 #include "Engine/LocalPlayer.h"
 #include "Net/UnrealNetwork.h"
 #include "Net/Core/PushModel/PushModel.h"
@@ -22,6 +23,8 @@
 #include "Interfaces/ALSXTCharacterInterface.h"
 #include "Curves/CurveVector.h"
 #include "RootMotionSources/ALSXTRootMotionSource_Vaulting.h"
+#include "Components/Character/ALSXTImpactReactionComponent.h"
+#include "Subsystems/ALSXTLagCompensationSubsystem.h"
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsUtility.h"
@@ -30,6 +33,41 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Notify/ALSXTAnimNotify_FootstepEffects.h"
+#include "Utility/ALSXTNetAccounting.h"
+#include "Utility/ALSXTStats.h"
+#include "Utility/ALSXTInterfaceUtility.h"
+
+namespace ALSXTCharacter
+{
+	void ResolveFootprintStatePhase(const UALSXTFootstepEffectsSettings& Settings, const EPhysicalSurface SurfaceType,
+	                                FALSXTFootprintStatePhase& Phase)
+	{
+		const auto* EffectSettings{Settings.FindEffectSettings(SurfaceType)};
+		if (EffectSettings != nullptr)
+		{
+			EffectSettings->ApplyToFootprintStatePhase(Phase);
+		}
+
+		Phase.SurfaceType = SurfaceType;
+	}
+
+	void ResolveFootprintState(const UALSXTFootstepEffectsSettings& Settings, const FALSXTFootprintNetState& NetState,
+	                           FALSXTFootprintState& State)
+	{
+		ResolveFootprintStatePhase(Settings, NetState.CurrentSurfaceType, State.Current);
+		ResolveFootprintStatePhase(Settings, NetState.PreviousSurfaceType, State.Previous);
+
+		State.FootSurfaceAlpha = NetState.GetFootSurfaceAlpha();
+	}
+
+	void MakeFootprintNetState(const FALSXTFootprintState& State, FALSXTFootprintNetState& NetState)
+	{
+		NetState.CurrentSurfaceType = State.Current.SurfaceType;
+		NetState.PreviousSurfaceType = State.Previous.SurfaceType;
+		NetState.SetFootSurfaceAlpha(State.FootSurfaceAlpha);
+	}
+}
 
 AALSXTCharacter::AALSXTCharacter(const FObjectInitializer& ObjectInitializer) :
 	Super(ObjectInitializer.SetDefaultSubobjectClass<UALSXTPaintableSkeletalMeshComponent>(AAlsCharacter::MeshComponentName).SetDefaultSubobjectClass<UALSXTCharacterMovementComponent>(AAlsCharacter::CharacterMovementComponentName))
@@ -263,8 +301,14 @@ void AALSXTCharacter::Tick(const float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	RefreshAnimationStateSnapshot();
 	RefreshVaulting();
 
+	if (bAttackTraceActive)
+	{
+		AttackCollisionTrace();
+	}
+
 	FVector Difference = GetActorUpVector() - GetCharacterMovement()->CurrentFloor.HitResult.Normal;
 	float Angle = FMath::RadiansToDegrees(FMath::Atan2(Difference.X, Difference.Y)) -90;
 	if (Angle > 45.00)
@@ -273,6 +317,40 @@ void AALSXTCharacter::Tick(const float DeltaTime)
 	}
 }
 
+void AALSXTCharacter::RefreshAnimationStateSnapshot()
+{
+	FALSXTAnimationStateSnapshot NewSnapshot;
+	NewSnapshot.Overlay = GetOverlayMode();
+	NewSnapshot.Freelooking = GetDesiredFreelooking();
+	NewSnapshot.Sex = GetDesiredSex();
+	NewSnapshot.DefensiveMode = GetDesiredDefensiveMode();
+	NewSnapshot.LocomotionVariant = GetDesiredLocomotionVariant();
+	NewSnapshot.Injury = GetDesiredInjury();
+	NewSnapshot.CombatStance = GetDesiredCombatStance();
+	NewSnapshot.WeaponFirearmStance = GetDesiredWeaponFirearmStance();
+	NewSnapshot.WeaponReadyPosition = GetDesiredWeaponReadyPosition();
+	NewSnapshot.StationaryMode = GetStationaryMode();
+	NewSnapshot.HoldingBreath = GetHoldingBreath();
+	NewSnapshot.DesiredHoldingBreath = GetDesiredHoldingBreath();
+	NewSnapshot.PhysicalAnimationMode = GetPhysicalAnimationMode();
+	NewSnapshot.Gesture = GetGesture();
+	NewSnapshot.GestureHand = GetGestureHand();
+	NewSnapshot.ReloadingType = GetReloadingType();
+	NewSnapshot.ForegripPosition = GetDesiredForegripPosition();
+	NewSnapshot.FirearmFingerAction = GetFirearmFingerAction();
+	NewSnapshot.FirearmFingerActionHand = GetFirearmFingerActionHand();
+	NewSnapshot.WeaponCarryPosition = GetWeaponCarryPosition();
+	NewSnapshot.FirearmSightLocation = GetFirearmSightLocation();
+	NewSnapshot.VaultType = GetVaultType();
+	NewSnapshot.WeaponObstruction = GetWeaponObstruction();
+
+	if (!NewSnapshot.HasSameTags(AnimationStateSnapshot))
+	{
+		NewSnapshot.Version = AnimationStateSnapshot.Version + 1;
+		AnimationStateSnapshot = NewSnapshot;
+	}
+}
+
 void AALSXTCharacter::NotifyControllerChanged()
 {
 	const auto* PreviousPlayer{Cast<APlayerController>(PreviousController)};
@@ -310,7 +388,7 @@ void AALSXTCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutL
 	Parameters.bIsPushBased = true;
 
 	Parameters.Condition = COND_SkipOwner;
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, FootprintsState, Parameters)
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, FootprintsNetState, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DefensiveModeState, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredFreelooking, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredSex, Parameters)
@@ -344,6 +422,21 @@ void AALSXTCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutL
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, MovementInput, Parameters)
 }
 
+void AALSXTCharacter::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	ALSXTNetAccounting::RecordReplicatedProperties(*this);
+}
+
+bool AALSXTCharacter::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	ALSXTStats::RecordRpc(Function);
+	ALSXTNetAccounting::RecordRpc(*this, *Function, Parameters);
+
+	return Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+}
+
 void AALSXTCharacter::BeginPlay()
 {
 	AlsCharacter = Cast<AAlsCharacter>(GetParentActor());
@@ -354,7 +447,16 @@ void AALSXTCharacter::BeginPlay()
 	GetMesh()->SetEnablePhysicsBlending(true);
 
 	FreelookTimerDelegate.BindUFunction(this, "AttackCollisionTrace");
-	AttackTraceTimerDelegate.BindUFunction(this, "AttackCollisionTrace", AttackTraceSettings);
+	AttackTraceDelegate.BindUObject(this, &ThisClass::OnAttackTraceCompleted);
+
+	if (HasAuthority())
+	{
+		auto* LagCompensation{GetWorld()->GetSubsystem<UALSXTLagCompensationSubsystem>()};
+		if (IsValid(LagCompensation))
+		{
+			LagCompensation->RegisterCharacter(this);
+		}
+	}
 }
 
 void AALSXTCharacter::CalcCamera(const float DeltaTime, FMinimalViewInfo& ViewInfo)
@@ -845,6 +947,26 @@ void AALSXTCharacter::ResetPaintOnAllComponents_Implementation() const
 	
 }
 
+void AALSXTCharacter::NativeGetActorMass(float& Mass)
+{
+	Mass = GetCharacterMovement()->Mass;
+}
+
+void AALSXTCharacter::NativeGetActorVelocity(FVector& Velocity)
+{
+	Velocity = GetVelocity();
+}
+
+FGameplayTag AALSXTCharacter::NativeGetStatus()
+{
+	return Status;
+}
+
+FGameplayTag AALSXTCharacter::NativeGetCombatStance()
+{
+	return CombatStance;
+}
+
 // UALSXTCharacterSoundSettings* AALSXTCharacter::SelectCharacterSoundSettings_Implementation() const
 // {
 // 
@@ -897,28 +1019,73 @@ void AALSXTCharacter::SetFootprintsState(const EALSXTFootBone& Foot, const FALSX
 
 	OnFootprintsStateChanged(PreviousFootprintsState);
 
-	if ((GetLocalRole() == ROLE_AutonomousProxy) && IsLocallyControlled())
+	FALSXTFootprintsNetState NewFootprintsNetState;
+	ALSXTCharacter::MakeFootprintNetState(NewFootprintsState.Left, NewFootprintsNetState.Left);
+	ALSXTCharacter::MakeFootprintNetState(NewFootprintsState.Right, NewFootprintsNetState.Right);
+
+	if (GetLocalRole() >= ROLE_Authority)
 	{
-		ServerSetFootprintsState(Foot, NewFootprintsState);
+		SetFootprintsNetState(NewFootprintsNetState);
+	}
+	else if ((GetLocalRole() == ROLE_AutonomousProxy) && IsLocallyControlled() && NewFootprintsNetState != FootprintsNetState)
+	{
+		// The footprints net state is not replicated to the owner, so it only tracks what was last sent to the server.
+		// The RPC is reliable, so the server can't miss a change the client skips sending again.
+
+		FootprintsNetState = NewFootprintsNetState;
+		ServerSetFootprintsNetState(NewFootprintsNetState);
 	}
 }
 
-void AALSXTCharacter::ServerSetFootprintsState_Implementation(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState)
+void AALSXTCharacter::SetFootprintsEffectsSettings(UALSXTFootstepEffectsSettings* NewFootprintsEffectsSettings)
 {
-	SetFootprintsState(Foot, NewFootprintsState);
+	if (FootprintsEffectsSettings != NewFootprintsEffectsSettings)
+	{
+		FootprintsEffectsSettings = NewFootprintsEffectsSettings;
+
+		if (GetLocalRole() == ROLE_SimulatedProxy)
+		{
+			ResolveFootprintsState();
+		}
+	}
 }
 
+void AALSXTCharacter::SetFootprintsNetState(const FALSXTFootprintsNetState& NewFootprintsNetState)
+{
+	if (FootprintsNetState != NewFootprintsNetState)
+	{
+		FootprintsNetState = NewFootprintsNetState;
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, FootprintsNetState, this)
+	}
+}
 
-void AALSXTCharacter::ServerProcessNewFootprintsState_Implementation(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState)
+void AALSXTCharacter::ServerSetFootprintsNetState_Implementation(const FALSXTFootprintsNetState& NewFootprintsNetState)
 {
-	ProcessNewFootprintsState(Foot, NewFootprintsState);
+	SetFootprintsNetState(NewFootprintsNetState);
+	ResolveFootprintsState();
 }
 
-void AALSXTCharacter::OnReplicate_FootprintsState(const FALSXTFootprintsState& PreviousFootprintsState)
+void AALSXTCharacter::ResolveFootprintsState()
 {
+	if (!IsValid(FootprintsEffectsSettings))
+	{
+		return;
+	}
+
+	const auto PreviousFootprintsState{FootprintsState};
+
+	ALSXTCharacter::ResolveFootprintState(*FootprintsEffectsSettings, FootprintsNetState.Left, FootprintsState.Left);
+	ALSXTCharacter::ResolveFootprintState(*FootprintsEffectsSettings, FootprintsNetState.Right, FootprintsState.Right);
+
 	OnFootprintsStateChanged(PreviousFootprintsState);
 }
 
+void AALSXTCharacter::OnReplicate_FootprintsNetState(const FALSXTFootprintsNetState& PreviousFootprintsNetState)
+{
+	ResolveFootprintsState();
+}
+
 void AALSXTCharacter::OnFootprintsStateChanged_Implementation(const FALSXTFootprintsState& PreviousFootprintsState) {}
 
 void AALSXTCharacter::InputToggleCombatReady()
@@ -1835,146 +2002,348 @@ void AALSXTCharacter::EndFreelookTimer()
 void AALSXTCharacter::BeginAttackCollisionTrace(FALSXTCombatAttackTraceSettings TraceSettings)
 {
 	AttackTraceSettings = TraceSettings;
-	GetWorld()->GetTimerManager().SetTimer(AttackTraceTimerHandle, AttackTraceTimerDelegate, 0.1f, true);
+
+	const auto GeneralCombatSettings{IALSXTCombatInterface::Execute_GetGeneralCombatSettings(this)};
+	AttackTraceObjectTypes = GeneralCombatSettings.AttackTraceObjectTypes;
+	MaxAttackTraceSubSteps = FMath::Max(1, GeneralCombatSettings.MaxAttackTraceSubSteps);
+	AttackTraceSubStepDistance = FMath::Max(1.0f, GeneralCombatSettings.AttackTraceSubStepDistance);
+
+	AttackTraceObjectQueryParameters = {};
+	for (const auto ObjectType : AttackTraceObjectTypes)
+	{
+		AttackTraceObjectQueryParameters.AddObjectTypesToQuery(UCollisionProfile::Get()->ConvertToCollisionChannel(false, ObjectType));
+	}
+
+	// Results of the previous attack may still be in flight, they keep checking against the actors it hit.
+
+	if (PendingAttackTraceRequests.ContainsByPredicate([this](const FALSXTAttackTraceRequest& Request)
+	{
+		return Request.Serial == AttackTraceSerial;
+	}))
+	{
+		PreviousAttackTraceLastHitActors = MoveTemp(AttackTraceLastHitActors);
+	}
+	else
+	{
+		PreviousAttackTraceLastHitActors.Reset();
+	}
+
+	AttackTraceLastHitActors.Reset();
+
+	AttackTraceSerial += 1;
+	bAttackTraceActive = true;
+	bHasAttackTraceSample = false;
 }
 
 void AALSXTCharacter::AttackCollisionTrace()
 {
-		// Update AttackTraceSettings
-		GetUnarmedTraceLocations(AttackTraceSettings.AttackType, AttackTraceSettings.Start, AttackTraceSettings.End, AttackTraceSettings.Radius);
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_AttackCollisionTrace, this);
+
+	// Update AttackTraceSettings
+	GetUnarmedTraceLocations(AttackTraceSettings.AttackType, AttackTraceSettings.Start, AttackTraceSettings.End, AttackTraceSettings.Radius);
+
+	if (!bHasAttackTraceSample)
+	{
+		PreviousAttackTraceStart = AttackTraceSettings.Start;
+		PreviousAttackTraceEnd = AttackTraceSettings.End;
+		bHasAttackTraceSample = true;
+	}
+
+	SweepAttackTrace(PreviousAttackTraceStart, PreviousAttackTraceEnd, true);
+
+	PreviousAttackTraceStart = AttackTraceSettings.Start;
+	PreviousAttackTraceEnd = AttackTraceSettings.End;
+}
+
+void AALSXTCharacter::SweepAttackTrace(const FVector& PreviousStart, const FVector& PreviousEnd, const bool bAsync)
+{
+	// The volume swept by the attack segment since the previous sample is covered by sweeping points spread along the
+	// segment from their previous to their current location, so fast swings can't pass through thin targets between
+	// two frames. The points are spaced by the sub-step distance, and their number is bounded. The segment itself is
+	// swept at its current location as well.
+
+	const auto TravelDistance{
+		FMath::Max(FVector::Dist(PreviousStart, AttackTraceSettings.Start), FVector::Dist(PreviousEnd, AttackTraceSettings.End))
+	};
+
+	const auto SegmentLength{
+		FMath::Max(FVector::Dist(PreviousStart, PreviousEnd), FVector::Dist(AttackTraceSettings.Start, AttackTraceSettings.End))
+	};
+
+	const auto PointCount{
+		TravelDistance > UE_KINDA_SMALL_NUMBER
+			? FMath::Clamp(FMath::CeilToInt32(SegmentLength / AttackTraceSubStepDistance) + 1, 1, MaxAttackTraceSubSteps)
+			: 0
+	};
+
+	static const FName AttackTraceTag{__FUNCTION__};
 
-		// Declare Local Vars
-		TArray<AActor*> InitialIgnoredActors;
-		TArray<AActor*> OriginTraceIgnoredActors;
-		TArray<FHitResult> HitResults;
-		InitialIgnoredActors.Add(this);	// Add Self to Initial Trace Ignored Actors
+	const FCollisionQueryParams QueryParameters{AttackTraceTag, false, this};
+	const auto CollisionShape{FCollisionShape::MakeSphere(AttackTraceSettings.Radius)};
 
-		FALSXTGeneralCombatSettings GeneralCombatSettings = IALSXTCombatInterface::Execute_GetGeneralCombatSettings(this);
-		TArray<TEnumAsByte<EObjectTypeQuery>> AttackTraceObjectTypes;
-		AttackTraceObjectTypes = GeneralCombatSettings.AttackTraceObjectTypes;
+	ALSXT_INC_DWORD_STAT_BY(STAT_ALSXT_Traces, PointCount + 1);
 
-		// Initial Trace
-		bool isHit = UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), AttackTraceSettings.Start, AttackTraceSettings.End, AttackTraceSettings.Radius, AttackTraceObjectTypes, false, InitialIgnoredActors, EDrawDebugTrace::None, HitResults, true, FLinearColor::Green, FLinearColor::Red, 0.0f);
+	// Async traces are gathered by the world and run together, the results arrive next frame. They are processed
+	// with the trace settings of this sample, since the attack segment will have moved on by then.
 
-		if (isHit)
+	if (bAsync)
+	{
+		auto& Request{PendingAttackTraceRequests.AddDefaulted_GetRef()};
+		Request.Id = ++AttackTraceRequestId;
+		Request.Serial = AttackTraceSerial;
+		Request.RemainingSweepCount = PointCount + 1;
+		Request.TraceSettings = AttackTraceSettings;
+	}
+
+	TArray<FHitResult> HitResults;
+
+	const auto Sweep{
+		[&](const FVector& SweepStart, const FVector& SweepEnd)
 		{
-			// Loop through HitResults Array
-			for (auto& HitResult : HitResults)
+			if (bAsync)
 			{
-				// Check if not in AttackedActors Array
-				if (!AttackTraceLastHitActors.Contains(HitResult.GetActor()))
-				{
-					// Add to AttackedActors Array
-					AttackTraceLastHitActors.AddUnique(HitResult.GetActor());
-
-					// Declare Local Vars
-					FAttackDoubleHitResult CurrentHitResult;
-					FGameplayTag ImpactLoc;
-					FGameplayTag ImpactStrength;
-					FGameplayTag ImpactSide;
-					FGameplayTag ImpactForm;
-					AActor* HitActor = HitResult.GetActor();
-					FString HitActorname;
-					FVector HitActorVelocity { FVector::ZeroVector };
-					float HitActorMass { 0.0f };
-					float HitActorAttackVelocity { 0.0f };
-					float HitActorAttackMass { 0.0f };
-					FVector TotalImpactEnergy { FVector::ZeroVector };
-
-					// Populate Hit
-					// 
-					
-					// Call OnActorAttackCollision on CollisionInterface
-					if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCollisionInterface::StaticClass()))
-					{
-						IALSXTCollisionInterface::Execute_GetActorVelocity(HitActor, HitActorVelocity);
-						IALSXTCollisionInterface::Execute_GetActorMass(HitActor, HitActorMass);
-					}
+				GetWorld()->AsyncSweepByObjectType(EAsyncTraceType::Multi, SweepStart, SweepEnd, FQuat::Identity,
+				                                   AttackTraceObjectQueryParameters, CollisionShape, QueryParameters,
+				                                   &AttackTraceDelegate, AttackTraceRequestId);
+			}
+			else
+			{
+				TArray<FHitResult> SweepHitResults;
+				GetWorld()->SweepMultiByObjectType(SweepHitResults, SweepStart, SweepEnd, FQuat::Identity,
+				                                   AttackTraceObjectQueryParameters, CollisionShape, QueryParameters);
 
-					// Get Attack Physics
-					if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCharacterInterface::StaticClass()))
-					{
-						IALSXTCharacterInterface::Execute_GetCombatAttackPhysics(HitActor, HitActorAttackMass, HitActorAttackVelocity);
-					}
+				HitResults.Append(SweepHitResults);
+			}
+		}
+	};
 
-					// TotalImpactEnergy = 50.0f + (HitActorVelocity * HitActorMass) + (HitActorAttackVelocity * HitActorAttackMass);
-					TotalImpactEnergy = (HitActorVelocity * HitActorMass) + (HitActorAttackVelocity * HitActorAttackMass);
-					// FMath::Square(TossSpeed)
-
-					FVector HitDirection = HitResult.ImpactPoint - GetActorLocation();
-					HitDirection.Normalize();
-					CurrentHitResult.DoubleHitResult.HitResult.Direction = HitDirection;
-					CurrentHitResult.DoubleHitResult.HitResult.Impulse = HitResult.Normal * TotalImpactEnergy;
-					CurrentHitResult.DoubleHitResult.HitResult.HitResult = HitResult;
-					GetLocationFromBoneName(CurrentHitResult.DoubleHitResult.HitResult.HitResult.BoneName, ImpactLoc);
-					CurrentHitResult.DoubleHitResult.HitResult.ImpactLocation = ImpactLoc;
-					CurrentHitResult.Type = AttackTraceSettings.AttackType;				
-					CurrentHitResult.DoubleHitResult.HitResult.ImpactSide = ImpactSide;
-					CurrentHitResult.Strength = AttackTraceSettings.AttackStrength;
-					CurrentHitResult.DoubleHitResult.HitResult.ImpactStrength = AttackTraceSettings.AttackStrength;					
-					HitActor = CurrentHitResult.DoubleHitResult.HitResult.HitResult.GetActor();
-					HitActorname = HitActor->GetName();
-
-
-					// Setup Origin Trace
-					FHitResult OriginHitResult;
-					OriginTraceIgnoredActors.Add(HitResult.GetActor());	// Add Hit Actor to Origin Trace Ignored Actors
-
-					// Perform Origin Trace
-					bool isOriginHit = UKismetSystemLibrary::SphereTraceSingleForObjects(GetWorld(), HitResult.Location, AttackTraceSettings.Start, AttackTraceSettings.Radius, AttackTraceObjectTypes, false, OriginTraceIgnoredActors, EDrawDebugTrace::None, OriginHitResult, true, FLinearColor::Green, FLinearColor::Red, 4.0f);
-
-					// Perform Origin Hit Trace to get PhysMat etc for ImpactLocation
-					if (isOriginHit)
-					{
-						// Populate Origin Hit
-						CurrentHitResult.DoubleHitResult.OriginHitResult.HitResult = OriginHitResult;
-					
-						// Populate Values based if Holding Item
-						if (IsHoldingItem())
-						{
-							GetHeldItemAttackDamageInfo(CurrentHitResult.Type, CurrentHitResult.Strength, CurrentHitResult.BaseDamage, CurrentHitResult.DoubleHitResult.HitResult.ImpactForm, CurrentHitResult.DoubleHitResult.HitResult.DamageType);
-						}
-						else
-						{
-							GetUnarmedAttackDamageInfo(CurrentHitResult.Type, CurrentHitResult.Strength, CurrentHitResult.BaseDamage, CurrentHitResult.DoubleHitResult.HitResult.ImpactForm, CurrentHitResult.DoubleHitResult.HitResult.DamageType);
-						}
-						FString OriginHitActorname = OriginHitResult.GetActor()->GetName();
-						CurrentHitResult.DoubleHitResult.OriginHitResult.HitResult = OriginHitResult;
-
-						GetFormFromHit(CurrentHitResult.DoubleHitResult, CurrentHitResult.DoubleHitResult.ImpactForm);
-						GetSideFromHit(CurrentHitResult.DoubleHitResult, CurrentHitResult.DoubleHitResult.ImpactSide);
-						GetStrengthFromHit(CurrentHitResult.DoubleHitResult, CurrentHitResult.Strength);
-						CurrentHitResult.DoubleHitResult.HitResult.ImpactStrength = CurrentHitResult.Strength;
-					}
-					// Call OnActorAttackCollision on CollisionInterface
-					if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCharacterInterface::StaticClass()))
-					{
-						IALSXTCharacterInterface::Execute_AttackReaction(HitActor, CurrentHitResult);
-					}
-					// Call OnActorAttackCollision on CollisionInterface
-					if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCollisionInterface::StaticClass()))
-					{
-						// GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Green, HitActorname);
-						IALSXTCollisionInterface::Execute_OnActorAttackCollision(HitActor, CurrentHitResult);
-					}
-					OnAttackHit(CurrentHitResult);
+	for (auto i{0}; i < PointCount; i++)
+	{
+		const auto Alpha{PointCount > 1 ? static_cast<float>(i) / (PointCount - 1) : 0.0f};
+
+		Sweep(FMath::Lerp(PreviousStart, PreviousEnd, Alpha), FMath::Lerp(AttackTraceSettings.Start, AttackTraceSettings.End, Alpha));
+	}
+
+	Sweep(AttackTraceSettings.Start, AttackTraceSettings.End);
+
+	if (!bAsync)
+	{
+		ProcessAttackTraceHits(HitResults, AttackTraceSettings, AttackTraceLastHitActors);
+	}
+}
+
+void AALSXTCharacter::OnAttackTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	const auto RequestIndex{
+		PendingAttackTraceRequests.IndexOfByPredicate([&TraceDatum](const FALSXTAttackTraceRequest& Request)
+		{
+			return Request.Id == TraceDatum.UserData;
+		})
+	};
+
+	if (RequestIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Copied, since processing the hits calls into blueprints, which may begin or end attack traces.
+
+	const auto Serial{PendingAttackTraceRequests[RequestIndex].Serial};
+	const auto TraceSettings{PendingAttackTraceRequests[RequestIndex].TraceSettings};
+
+	PendingAttackTraceRequests[RequestIndex].RemainingSweepCount -= 1;
+	if (PendingAttackTraceRequests[RequestIndex].RemainingSweepCount <= 0)
+	{
+		PendingAttackTraceRequests.RemoveAt(RequestIndex);
+	}
+
+	if (Serial == AttackTraceSerial)
+	{
+		ProcessAttackTraceHits(TraceDatum.OutHits, TraceSettings, AttackTraceLastHitActors);
+	}
+	else if (Serial == AttackTraceSerial - 1)
+	{
+		ProcessAttackTraceHits(TraceDatum.OutHits, TraceSettings, PreviousAttackTraceLastHitActors);
+	}
+
+	if (!bAttackTraceActive && PendingAttackTraceRequests.IsEmpty())
+	{
+		AttackTraceLastHitActors.Empty();
+		PreviousAttackTraceLastHitActors.Empty();
+	}
+}
+
+void AALSXTCharacter::ProcessAttackTraceHits(const TArray<FHitResult>& HitResults, const FALSXTCombatAttackTraceSettings& TraceSettings,
+                                             TArray<AActor*>& HitActors)
+{
+	TArray<AActor*> OriginTraceIgnoredActors;
+	const auto* GameState{GetWorld()->GetGameState()};
+	const auto HitTimeStamp{IsValid(GameState) ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds()};
+
+	// Loop through HitResults Array
+	for (const auto& HitResult : HitResults)
+	{
+		// Check if not in AttackedActors Array
+		if (!HitActors.Contains(HitResult.GetActor()))
+		{
+			// Add to AttackedActors Array
+			HitActors.AddUnique(HitResult.GetActor());
+
+			// Declare Local Vars
+			FAttackDoubleHitResult CurrentHitResult;
+			FGameplayTag ImpactLoc;
+			FGameplayTag ImpactStrength;
+			FGameplayTag ImpactSide;
+			FGameplayTag ImpactForm;
+			AActor* HitActor = HitResult.GetActor();
+			FString HitActorname;
+			FVector HitActorVelocity { FVector::ZeroVector };
+			float HitActorMass { 0.0f };
+			float HitActorAttackVelocity { 0.0f };
+			float HitActorAttackMass { 0.0f };
+			FVector TotalImpactEnergy { FVector::ZeroVector };
+
+			// Populate Hit
+			// 
+			
+			// Call OnActorAttackCollision on CollisionInterface
+			if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCollisionInterface::StaticClass()))
+			{
+				ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorVelocity, HitActor, HitActorVelocity);
+				ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorMass, HitActor, HitActorMass);
+			}
+
+			// Get Attack Physics
+			if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCharacterInterface::StaticClass()))
+			{
+				IALSXTCharacterInterface::Execute_GetCombatAttackPhysics(HitActor, HitActorAttackMass, HitActorAttackVelocity);
+			}
+
+			// TotalImpactEnergy = 50.0f + (HitActorVelocity * HitActorMass) + (HitActorAttackVelocity * HitActorAttackMass);
+			TotalImpactEnergy = (HitActorVelocity * HitActorMass) + (HitActorAttackVelocity * HitActorAttackMass);
+			// FMath::Square(TossSpeed)
+
+			FVector HitDirection = HitResult.ImpactPoint - GetActorLocation();
+			HitDirection.Normalize();
+			CurrentHitResult.DoubleHitResult.HitResult.Direction = HitDirection;
+			CurrentHitResult.DoubleHitResult.HitResult.Impulse = HitResult.Normal * TotalImpactEnergy;
+			CurrentHitResult.DoubleHitResult.HitResult.HitResult = HitResult;
+			GetLocationFromBoneName(CurrentHitResult.DoubleHitResult.HitResult.HitResult.BoneName, ImpactLoc);
+			CurrentHitResult.DoubleHitResult.HitResult.ImpactLocation = ImpactLoc;
+			CurrentHitResult.Type = TraceSettings.AttackType;				
+			CurrentHitResult.DoubleHitResult.HitResult.ImpactSide = ImpactSide;
+			CurrentHitResult.Strength = TraceSettings.AttackStrength;
+			CurrentHitResult.DoubleHitResult.HitResult.ImpactStrength = TraceSettings.AttackStrength;					
+			CurrentHitResult.TimeStamp = HitTimeStamp;
+			HitActor = CurrentHitResult.DoubleHitResult.HitResult.HitResult.GetActor();
+			HitActorname = HitActor->GetName();
+
+
+			// Setup Origin Trace
+			FHitResult OriginHitResult;
+			OriginTraceIgnoredActors.Add(HitResult.GetActor());	// Add Hit Actor to Origin Trace Ignored Actors
+
+			// Perform Origin Trace
+			ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
+			bool isOriginHit = UKismetSystemLibrary::SphereTraceSingleForObjects(GetWorld(), HitResult.Location, TraceSettings.Start, TraceSettings.Radius, AttackTraceObjectTypes, false, OriginTraceIgnoredActors, EDrawDebugTrace::None, OriginHitResult, true, FLinearColor::Green, FLinearColor::Red, 4.0f);
+
+			// Perform Origin Hit Trace to get PhysMat etc for ImpactLocation
+			if (isOriginHit)
+			{
+				// Populate Origin Hit
+				CurrentHitResult.DoubleHitResult.OriginHitResult.HitResult = OriginHitResult;
+			
+				// Populate Values based if Holding Item
+				if (IsHoldingItem())
+				{
+					GetHeldItemAttackDamageInfo(CurrentHitResult.Type, CurrentHitResult.Strength, CurrentHitResult.BaseDamage, CurrentHitResult.DoubleHitResult.HitResult.ImpactForm, CurrentHitResult.DoubleHitResult.HitResult.DamageType);
+				}
+				else
+				{
+					GetUnarmedAttackDamageInfo(CurrentHitResult.Type, CurrentHitResult.Strength, CurrentHitResult.BaseDamage, CurrentHitResult.DoubleHitResult.HitResult.ImpactForm, CurrentHitResult.DoubleHitResult.HitResult.DamageType);
 				}
+				FString OriginHitActorname = OriginHitResult.GetActor()->GetName();
+				CurrentHitResult.DoubleHitResult.OriginHitResult.HitResult = OriginHitResult;
+
+				GetFormFromHit(CurrentHitResult.DoubleHitResult, CurrentHitResult.DoubleHitResult.ImpactForm);
+				GetSideFromHit(CurrentHitResult.DoubleHitResult, CurrentHitResult.DoubleHitResult.ImpactSide);
+				GetStrengthFromHit(CurrentHitResult.DoubleHitResult, CurrentHitResult.Strength);
+				CurrentHitResult.DoubleHitResult.HitResult.ImpactStrength = CurrentHitResult.Strength;
+			}
+			// Call OnActorAttackCollision on CollisionInterface
+			if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCharacterInterface::StaticClass()))
+			{
+				IALSXTCharacterInterface::Execute_AttackReaction(HitActor, CurrentHitResult);
+			}
+
+			ReportAttackHit(CurrentHitResult);
+
+			// Call OnActorAttackCollision on CollisionInterface
+			if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCollisionInterface::StaticClass()))
+			{
+				// GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Green, HitActorname);
+				IALSXTCollisionInterface::Execute_OnActorAttackCollision(HitActor, CurrentHitResult);
 			}
+			OnAttackHit(CurrentHitResult);
 		}
+	}
+}
+
+void AALSXTCharacter::ReportAttackHit(const FAttackDoubleHitResult& Hit)
+{
+	if (GetLocalRole() == ROLE_AutonomousProxy)
+	{
+		ServerReportAttackHit(Hit);
+	}
+	else if (HasAuthority() && GetRemoteRole() != ROLE_AutonomousProxy)
+	{
+		// Characters controlled by remote clients report their own hits, the server's trace of them is not used.
+
+		ApplyAttackHit(Hit);
+	}
+}
+
+void AALSXTCharacter::ServerReportAttackHit_Implementation(const FAttackDoubleHitResult& Hit)
+{
+	ApplyAttackHit(Hit);
+}
+
+void AALSXTCharacter::ApplyAttackHit(const FAttackDoubleHitResult& Hit)
+{
+	const auto* Target{Hit.DoubleHitResult.HitResult.HitResult.GetActor()};
+	auto* ImpactReaction{IsValid(Target) ? Target->FindComponentByClass<UALSXTImpactReactionComponent>() : nullptr};
+
+	if (IsValid(ImpactReaction))
+	{
+		ImpactReaction->ReceiveAttackHit(*this, Hit);
+	}
 }
 
 void AALSXTCharacter::EndAttackCollisionTrace()
 {
-	// Clear Attack Trace Timer
-	GetWorld()->GetTimerManager().ClearTimer(AttackTraceTimerHandle);
+	// Sweep the movement since the last sample right away instead of waiting for an async result. Results of
+	// earlier samples that are still in flight are processed when they arrive.
+
+	if (bAttackTraceActive && bHasAttackTraceSample)
+	{
+		GetUnarmedTraceLocations(AttackTraceSettings.AttackType, AttackTraceSettings.Start, AttackTraceSettings.End, AttackTraceSettings.Radius);
+		SweepAttackTrace(PreviousAttackTraceStart, PreviousAttackTraceEnd, false);
+	}
+
+	bAttackTraceActive = false;
+	bHasAttackTraceSample = false;
 
 	// Reset Attack Trace Settings
 	AttackTraceSettings.Start = { 0.0f, 0.0f, 0.0f };
 	AttackTraceSettings.End = { 0.0f, 0.0f, 0.0f };
 	AttackTraceSettings.Radius = { 0.0f };
 
-	// Empty AttackTraceLastHitActors Array
-	AttackTraceLastHitActors.Empty();
+	// Empty AttackTraceLastHitActors Array once no results are pending
+	if (PendingAttackTraceRequests.IsEmpty())
+	{
+		AttackTraceLastHitActors.Empty();
+		PreviousAttackTraceLastHitActors.Empty();
+	}
 }
 
 // HoldingBreath
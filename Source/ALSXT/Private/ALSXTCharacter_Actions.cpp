@@ -19,6 +19,7 @@
 #include "Utility/AlsMath.h"
 #include "Utility/ALSXTGameplayTags.h"
 #include "Utility/AlsUtility.h"
+#include "Utility/ALSXTStats.h"
 
 void AALSXTCharacter::TryStartSliding(const float PlayRate)
 {
@@ -164,6 +165,13 @@ bool AALSXTCharacter::IsVaultingAllowedToStart_Implementation(FVaultAnimation Va
 
 bool AALSXTCharacter::TryStartVaulting(const FALSXTVaultingTraceSettings& TraceSettings)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_TryStartVaulting, this);
+
+	if (!ALSXTSettings->Vaulting.bAllowVaulting || GetLocalRole() <= ROLE_SimulatedProxy)
+	{
+		return false;
+	}
+
 	const auto ActorLocation{GetActorLocation()};
 	const auto ActorYawAngle{UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(GetActorRotation().Yaw))};
 	const auto* Capsule{ GetCapsuleComponent() };
@@ -236,6 +244,7 @@ bool AALSXTCharacter::TryStartVaulting(const FALSXTVaultingTraceSettings& TraceS
 	const auto ForwardTraceCapsuleHalfHeight{LedgeHeightDelta * 0.5f};
 	FHitResult ForwardTraceHit;
 
+	ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
 	GetWorld()->SweepSingleByObjectType(ForwardTraceHit, ForwardTraceStart, ForwardTraceEnd, FQuat::Identity, ObjectQueryParameters,
 		FCollisionShape::MakeCapsule(TraceCapsuleRadius, ForwardTraceCapsuleHalfHeight),
 		{ ForwardTraceTag, false, this });
@@ -260,24 +269,93 @@ bool AALSXTCharacter::TryStartVaulting(const FALSXTVaultingTraceSettings& TraceS
 		return false;
 	}
 
-	// DEPTH TRACE
-	// Check if obstacle object is thin enough to vault
-	
-	// Set Local Variables
-	FHitResult DepthTraceHit;
-	static const FName DepthTraceTag{ __FUNCTION__ TEXT(" (Depth Trace)") };
-	FVector HitLocation = ForwardTraceHit.ImpactPoint;
-	FVector HitNormal = ForwardTraceHit.ImpactNormal;
-	FVector DepthStartLocation = HitLocation + (ForwardTraceHit.ImpactNormal * (TraceSettings.MaxDepth * -1));
-	FVector DepthEndLocation = ForwardTraceHit.ImpactPoint + (ForwardTraceHit.ImpactNormal * (1 * -1));
-	TArray<AActor*> DepthIgnoreActors;
-	DepthIgnoreActors.Add(this);
+	float ForwardMomentumLandingDistance {0.0f};
+	const auto Speed{GetVelocity().Size()};
+	if (Speed < 333.0)
+	{
+		ForwardMomentumLandingDistance = ALSXTSettings->Vaulting.WalkVaultingForwardDistance;
+	}
+	if (Speed > 333.0 && Speed < 600.0)
+	{
+		ForwardMomentumLandingDistance = ALSXTSettings->Vaulting.RunVaultingForwardDistance;
+	}
+	if (Speed > 600.0)
+	{
+		ForwardMomentumLandingDistance = ALSXTSettings->Vaulting.SprintVaultingForwardDistance;
+	}
 
-	UKismetSystemLibrary::CapsuleTraceSingleForObjects(GetWorld(), DepthStartLocation, DepthEndLocation, CapsuleRadius, CapsuleHalfHeight / 2, ALSXTSettings->Vaulting.VaultingTraceObjectTypes, false, DepthIgnoreActors, EDrawDebugTrace::None, DepthTraceHit, true, FLinearColor::Black, FLinearColor::Red, 5.0f);
+	TArray<AActor*> IgnoreActors;
+	IgnoreActors.Add(this);
+
+	// The depth and downward traces below only depend on the shape of the ledge, so repeated attempts at the same
+	// ledge from the same direction reuse their recent result instead of tracing again. Ledges that can move, such
+	// as doors, are always traced, since their shape relative to the character can change between attempts.
+
+	const auto LedgeHeightOffset{UE_REAL_TO_FLOAT(ForwardTraceHit.ImpactPoint.Z - CapsuleBottomLocation.Z)};
+	const auto* CachedProbe{FindVaultingProbe(TraceSettings, TargetPrimitive, ForwardTraceHit.ImpactPoint, ForwardTraceDirection, LedgeHeightOffset)};
+
+	const auto CacheVaultingProbe{
+		[&](const bool bSuccessful, const FVector& ProbeLedgeLocation = FVector::ZeroVector)
+		{
+			FALSXTVaultingProbe Probe;
+			Probe.TraceSettings = &TraceSettings;
+			Probe.TargetPrimitive = TargetPrimitive;
+			Probe.RelativeImpactLocation = TargetPrimitive->GetComponentTransform().InverseTransformPosition(ForwardTraceHit.ImpactPoint);
+			Probe.RelativeLedgeLocation = TargetPrimitive->GetComponentTransform().InverseTransformPosition(ProbeLedgeLocation);
+			Probe.ApproachDirection = ForwardTraceDirection;
+			Probe.LedgeHeightOffset = LedgeHeightOffset;
+			Probe.Time = GetWorld()->GetTimeSeconds();
+			Probe.bSuccessful = bSuccessful;
+
+			AddVaultingProbe(Probe);
+		}
+	};
 
-	// Check if object is thicker than MaxDepth
-	if(!DepthTraceHit.IsValidBlockingHit())
+	FVector LedgeLocation;
+
+	if (CachedProbe != nullptr)
+	{
+		if (!CachedProbe->bSuccessful)
+		{
+			return false;
+		}
+
+		LedgeLocation = TargetPrimitive->GetComponentTransform().TransformPosition(CachedProbe->RelativeLedgeLocation);
+	}
+	else
 	{
+		// DEPTH TRACE
+		// Check if obstacle object is thin enough to vault
+		
+		// Set Local Variables
+		FHitResult DepthTraceHit;
+		static const FName DepthTraceTag{ __FUNCTION__ TEXT(" (Depth Trace)") };
+		FVector HitLocation = ForwardTraceHit.ImpactPoint;
+		FVector HitNormal = ForwardTraceHit.ImpactNormal;
+		FVector DepthStartLocation = HitLocation + (ForwardTraceHit.ImpactNormal * (TraceSettings.MaxDepth * -1));
+		FVector DepthEndLocation = ForwardTraceHit.ImpactPoint + (ForwardTraceHit.ImpactNormal * (1 * -1));
+		TArray<AActor*> DepthIgnoreActors;
+		DepthIgnoreActors.Add(this);
+
+		ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
+		UKismetSystemLibrary::CapsuleTraceSingleForObjects(GetWorld(), DepthStartLocation, DepthEndLocation, CapsuleRadius, CapsuleHalfHeight / 2, ALSXTSettings->Vaulting.VaultingTraceObjectTypes, false, DepthIgnoreActors, EDrawDebugTrace::None, DepthTraceHit, true, FLinearColor::Black, FLinearColor::Red, 5.0f);
+
+		// Check if object is thicker than MaxDepth
+		if(!DepthTraceHit.IsValidBlockingHit())
+		{
+
+#if ENABLE_DRAW_DEBUG
+			if (bDisplayDebug)
+			{
+				UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), DepthStartLocation, DepthEndLocation, TraceCapsuleRadius,
+					ForwardTraceCapsuleHalfHeight, false, DepthTraceHit, FLinearColor::Yellow,
+					{ 0.0f, 0.75f, 1.0f }, TraceSettings.bDrawFailedTraces ? 5.0f : 5.0f);
+			}
+#endif
+
+			CacheVaultingProbe(false);
+			return false;
+		}
 
 #if ENABLE_DRAW_DEBUG
 		if (bDisplayDebug)
@@ -288,144 +366,130 @@ bool AALSXTCharacter::TryStartVaulting(const FALSXTVaultingTraceSettings& TraceS
 		}
 #endif
 
-		return false;
-	}
+		auto* DepthPrimitive{ DepthTraceHit.GetComponent() };
 
-#if ENABLE_DRAW_DEBUG
-	if (bDisplayDebug)
-	{
-		UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), DepthStartLocation, DepthEndLocation, TraceCapsuleRadius,
-			ForwardTraceCapsuleHalfHeight, false, DepthTraceHit, FLinearColor::Yellow,
-			{ 0.0f, 0.75f, 1.0f }, TraceSettings.bDrawFailedTraces ? 5.0f : 5.0f);
-	}
-#endif
+		// Trace downward from the first trace's impact point and determine if the hit location is walkable.
 
-	auto* DepthPrimitive{ DepthTraceHit.GetComponent() };
+		static const FName DownwardTraceTag{__FUNCTION__ TEXT(" (Downward Trace)")};
 
-	// Trace downward from the first trace's impact point and determine if the hit location is walkable.
+		const auto TargetLocationOffset{
+			FVector2D{ForwardTraceHit.ImpactNormal.GetSafeNormal2D()} * (TraceSettings.TargetLocationOffset * CapsuleScale)
+		};
 
-	static const FName DownwardTraceTag{__FUNCTION__ TEXT(" (Downward Trace)")};
+		const FVector DownwardTraceStart{
+			ForwardTraceHit.ImpactPoint.X - TargetLocationOffset.X,
+			ForwardTraceHit.ImpactPoint.Y - TargetLocationOffset.Y,
+			CapsuleBottomLocation.Z + LedgeHeightDelta + 2.5f * TraceCapsuleRadius + UCharacterMovementComponent::MIN_FLOOR_DIST
+		};
 
-	const auto TargetLocationOffset{
-		FVector2D{ForwardTraceHit.ImpactNormal.GetSafeNormal2D()} * (TraceSettings.TargetLocationOffset * CapsuleScale)
-	};
+		const FVector DownwardTraceEnd{
+			DownwardTraceStart.X,
+			DownwardTraceStart.Y,
+			CapsuleBottomLocation.Z +
+			TraceSettings.LedgeHeight.GetMin()
+			//TraceSettings.LedgeHeight.GetMin() * CapsuleScale + TraceCapsuleRadius - UCharacterMovementComponent::MAX_FLOOR_DIST
+		};
 
-	const FVector DownwardTraceStart{
-		ForwardTraceHit.ImpactPoint.X - TargetLocationOffset.X,
-		ForwardTraceHit.ImpactPoint.Y - TargetLocationOffset.Y,
-		CapsuleBottomLocation.Z + LedgeHeightDelta + 2.5f * TraceCapsuleRadius + UCharacterMovementComponent::MIN_FLOOR_DIST
-	};
+		TArray<FHitResult> DownwardTraceHits;
+		FHitResult DownwardTraceHit;
 
-	const FVector DownwardTraceEnd{
-		DownwardTraceStart.X,
-		DownwardTraceStart.Y,
-		CapsuleBottomLocation.Z +
-		TraceSettings.LedgeHeight.GetMin()
-		//TraceSettings.LedgeHeight.GetMin() * CapsuleScale + TraceCapsuleRadius - UCharacterMovementComponent::MAX_FLOOR_DIST
-	};
+		ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
+		GetWorld()->SweepSingleByObjectType(DownwardTraceHit, DownwardTraceStart, DownwardTraceEnd, FQuat::Identity,
+		                                    ObjectQueryParameters, FCollisionShape::MakeSphere(TraceCapsuleRadius),
+		                                    {DownwardTraceTag, false, this});
 
-	TArray<FHitResult> DownwardTraceHits;
-	FHitResult DownwardTraceHit;
-	GetWorld()->SweepSingleByObjectType(DownwardTraceHit, DownwardTraceStart, DownwardTraceEnd, FQuat::Identity,
-	                                    ObjectQueryParameters, FCollisionShape::MakeSphere(TraceCapsuleRadius),
-	                                    {DownwardTraceTag, false, this});
+		TArray<AActor*> DownwardIgnoreActors;
+		DownwardIgnoreActors.Add(this);
 
-	TArray<AActor*> DownwardIgnoreActors;
-	DownwardIgnoreActors.Add(this);
+		ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
+		UKismetSystemLibrary::LineTraceMultiForObjects(GetWorld(), DownwardTraceStart, DownwardTraceEnd, ALSXTSettings->Vaulting.VaultingTraceObjectTypes, false, DownwardIgnoreActors, EDrawDebugTrace::None, DownwardTraceHits, true, FLinearColor::White, FLinearColor::Green, 5.0f);
 
-	UKismetSystemLibrary::LineTraceMultiForObjects(GetWorld(), DownwardTraceStart, DownwardTraceEnd, ALSXTSettings->Vaulting.VaultingTraceObjectTypes, false, DownwardIgnoreActors, EDrawDebugTrace::None, DownwardTraceHits, true, FLinearColor::White, FLinearColor::Green, 5.0f);
+		for (FHitResult DownTraceHit : DownwardTraceHits)
+		{
+			// Check if DownTrace Hit Actor is the Same and Forward Hit Race Actor
+			// TODO Check instead if Perpendicular to Forward Trace Normal
+			if (ForwardTraceHit.GetActor() == DownTraceHit.GetActor())
+			{
+				DownwardTraceHit = DownTraceHit;
+			}
+		}
 
-	for (FHitResult DownTraceHit : DownwardTraceHits)
-	{
-		// Check if DownTrace Hit Actor is the Same and Forward Hit Race Actor
-		// TODO Check instead if Perpendicular to Forward Trace Normal
-		if (ForwardTraceHit.GetActor() == DownTraceHit.GetActor())
+		if (!GetCharacterMovement()->IsWalkable(DownwardTraceHit))
 		{
-			DownwardTraceHit = DownTraceHit;
+#if ENABLE_DRAW_DEBUG
+			if (bDisplayDebug)
+			{
+				UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+				                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
+				                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+
+				UAlsUtility::DrawDebugSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
+				                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
+				                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
+			}
+#endif
+
+			CacheVaultingProbe(false);
+			return false;
 		}
-	}
 
-	if (!GetCharacterMovement()->IsWalkable(DownwardTraceHit))
-	{
+		LedgeLocation = DownwardTraceHit.ImpactPoint;
+
+		const FVector LedgeTargetLocation{
+			LedgeLocation.X,
+			LedgeLocation.Y,
+			LedgeLocation.Z + UCharacterMovementComponent::MIN_FLOOR_DIST
+		};
+
+		const FVector TargetCapsuleLocation{LedgeTargetLocation.X, LedgeTargetLocation.Y, LedgeTargetLocation.Z + CapsuleHalfHeight};
+
 #if ENABLE_DRAW_DEBUG
 		if (bDisplayDebug)
 		{
 			UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
+			                                                    {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f}, 5.0f);
 
-			UAlsUtility::DrawDebugSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
-			                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
-			                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
+			UAlsUtility::DrawDebugSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd,
+			                                        TraceCapsuleRadius, true, DownwardTraceHit,
+			                                        {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f}, 7.5f);
 		}
 #endif
 
-		return false;
+		CacheVaultingProbe(true, LedgeLocation);
 	}
 
 	const FVector TargetLocation{
-		DownwardTraceHit.ImpactPoint.X,
-		DownwardTraceHit.ImpactPoint.Y,
-		DownwardTraceHit.ImpactPoint.Z + UCharacterMovementComponent::MIN_FLOOR_DIST
+		LedgeLocation.X,
+		LedgeLocation.Y,
+		LedgeLocation.Z + UCharacterMovementComponent::MIN_FLOOR_DIST
 	};
 
 	const FVector TargetCapsuleLocation{TargetLocation.X, TargetLocation.Y, TargetLocation.Z + CapsuleHalfHeight};
 
-
-#if ENABLE_DRAW_DEBUG
-	if (bDisplayDebug)
-	{
-		UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-		                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
-		                                                    {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f}, 5.0f);
-
-		UAlsUtility::DrawDebugSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd,
-		                                        TraceCapsuleRadius, true, DownwardTraceHit,
-		                                        {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f}, 7.5f);
-	}
-#endif
-	
 	//
 	// Vaulting Room Trace
+	// Not cached, since the room above the ledge can be blocked and cleared by other moving actors.
 
-	// Vaulting Room Trace Hit Result
-	FHitResult LandingTraceHit;
-	static const FName LandingTraceTag{ __FUNCTION__ TEXT(" (Landing Trace)") };
-
-	// Set Local Variables
-	// const FVector LandingStartLocation{	TargetCapsuleLocation + (DepthTraceHit.Normal * 60) + (DownwardTraceHit.Normal * -(CapsuleHalfHeight * 1)) };
-	const FVector LandingStartLocation{ TargetCapsuleLocation };
 	const FVector ActionRoomCheckLocation{ TargetCapsuleLocation - (GetActorUpVector() * (CapsuleHalfHeight / 2)) };
-	// const FVector LandingStartLocation = TargetCapsuleLocation;
-	//const FVector LandingEndLocation{ LandingStartLocation.X, LandingStartLocation.Y, GetActorLocation().Z };
-
-	float ForwardMomentumLandingDistance {0.0f};
-	if (GetVelocity().Size() < 333.0)
-	{
-		ForwardMomentumLandingDistance = ALSXTSettings->Vaulting.WalkVaultingForwardDistance;
-	}
-	if (GetVelocity().Size() > 333.0 && GetVelocity().Size() < 600.0)
-	{
-		ForwardMomentumLandingDistance = ALSXTSettings->Vaulting.RunVaultingForwardDistance;
-	}
-	if (GetVelocity().Size() > 600.0)
-	{
-		ForwardMomentumLandingDistance = ALSXTSettings->Vaulting.SprintVaultingForwardDistance;
-	}
-
-	const FVector LandingEndLocation{ GetActorLocation() + (GetActorForwardVector() * ForwardMomentumLandingDistance) };
 	TArray<FHitResult> HitResults;
-	TArray<AActor*> IgnoreActors;
-	IgnoreActors.Add(this);
 
 	// Trace for room for Vaulting action
+	ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
 	if (UKismetSystemLibrary::CapsuleTraceMultiForObjects(GetWorld(), ActionRoomCheckLocation, ActionRoomCheckLocation, CapsuleRadius, CapsuleHalfHeight/2, ALSXTSettings->Vaulting.VaultingTraceObjectTypes, false, IgnoreActors, EDrawDebugTrace::None, HitResults, true, FLinearColor::Yellow, FLinearColor::Blue, 5.0f))
 	{
-		FString LandingHit = HitResults[0].GetActor()->GetName();
-		GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Yellow, LandingHit);
+#if ENABLE_DRAW_DEBUG
+		if (bDisplayDebug)
+		{
+			GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Yellow, GetNameSafe(HitResults[0].GetActor()));
+		}
+#endif
+
 		return false;
 	}
 
+	const FVector LandingEndLocation{ GetActorLocation() + (GetActorForwardVector() * ForwardMomentumLandingDistance) };
+
 	//
 	// Landing Location Trace
 
@@ -477,16 +541,16 @@ bool AALSXTCharacter::TryStartVaulting(const FALSXTVaultingTraceSettings& TraceS
 			}
 		}
 
-		HandPlantLocation = DownwardTraceHit.ImpactPoint - (GetActorUpVector() * VaultingAnimation.VerticalOffset);
+		HandPlantLocation = LedgeLocation - (GetActorUpVector() * VaultingAnimation.VerticalOffset);
 		// LandingPointLocation = DownwardTraceHit.ImpactPoint - (GetActorUpVector() * VaultingAnimation.VerticalOffset) - (ForwardTraceHit.ImpactNormal * CapsuleRadius);
-		LandingPointLocation = DownwardTraceHit.ImpactPoint - (GetActorUpVector() * VaultingAnimation.VerticalOffset) - (ForwardTraceHit.ImpactNormal * ForwardMomentumLandingDistance);
+		LandingPointLocation = LedgeLocation - (GetActorUpVector() * VaultingAnimation.VerticalOffset) - (ForwardTraceHit.ImpactNormal * ForwardMomentumLandingDistance);
 
 	}
 	else
 	{
-		HandPlantLocation = DownwardTraceHit.ImpactPoint - (GetActorUpVector() * VaultingAnimation.VerticalOffset);
+		HandPlantLocation = LedgeLocation - (GetActorUpVector() * VaultingAnimation.VerticalOffset);
 		// LandingPointLocation = DownwardTraceHit.ImpactPoint - (GetActorUpVector() *  VaultingAnimation.VerticalOffset) - (ForwardTraceHit.ImpactNormal * CapsuleRadius);
-		LandingPointLocation = DownwardTraceHit.ImpactPoint - (GetActorUpVector() * VaultingAnimation.VerticalOffset) - (ForwardTraceHit.ImpactNormal * ForwardMomentumLandingDistance);
+		LandingPointLocation = LedgeLocation - (GetActorUpVector() * VaultingAnimation.VerticalOffset) - (ForwardTraceHit.ImpactNormal * ForwardMomentumLandingDistance);
 	}
 
 	const auto TargetRotation{(-ForwardTraceHit.ImpactNormal.GetSafeNormal2D()).ToOrientationQuat()};
@@ -495,7 +559,7 @@ bool AALSXTCharacter::TryStartVaulting(const FALSXTVaultingTraceSettings& TraceS
 	Parameters.VaultingHeight = UE_REAL_TO_FLOAT((TargetLocation.Z - CapsuleBottomLocation.Z) / CapsuleScale);
 	// Parameters.VaultingHeight = UE_REAL_TO_FLOAT(TargetLocation.Z);
 
-	if (!ALSXTSettings->Vaulting.bAllowVaulting || GetLocalRole() <= ROLE_SimulatedProxy || !IsVaultingAllowedToStart(VaultingAnimation))
+	if (!IsVaultingAllowedToStart(VaultingAnimation))
 	{
 		return false;
 	}
@@ -551,6 +615,52 @@ bool AALSXTCharacter::TryStartVaulting(const FALSXTVaultingTraceSettings& TraceS
 	return true;
 }
 
+const FALSXTVaultingProbe* AALSXTCharacter::FindVaultingProbe(const FALSXTVaultingTraceSettings& TraceSettings,
+                                                              const UPrimitiveComponent* TargetPrimitive, const FVector& ImpactLocation,
+                                                              const FVector& ApproachDirection, const float LedgeHeightOffset) const
+{
+	const auto& VaultingSettings{ALSXTSettings->Vaulting};
+	if (VaultingSettings.ProbeCacheLifetime <= 0.0f || TargetPrimitive->Mobility == EComponentMobility::Movable)
+	{
+		return nullptr;
+	}
+
+	const auto CurrentTime{GetWorld()->GetTimeSeconds()};
+	const auto LocationToleranceSquared{FMath::Square(VaultingSettings.ProbeCacheLocationTolerance)};
+	const auto AngleToleranceCos{FMath::Cos(FMath::DegreesToRadians(VaultingSettings.ProbeCacheAngleTolerance))};
+
+	for (const auto& Probe : VaultingProbes)
+	{
+		if (Probe.TraceSettings != &TraceSettings || Probe.TargetPrimitive.Get() != TargetPrimitive ||
+		    CurrentTime - Probe.Time > VaultingSettings.ProbeCacheLifetime ||
+		    FMath::Abs(Probe.LedgeHeightOffset - LedgeHeightOffset) > VaultingSettings.ProbeCacheLocationTolerance ||
+		    (Probe.ApproachDirection | ApproachDirection) < AngleToleranceCos)
+		{
+			continue;
+		}
+
+		const auto ProbeImpactLocation{TargetPrimitive->GetComponentTransform().TransformPosition(Probe.RelativeImpactLocation)};
+		if (FVector::DistSquared(ProbeImpactLocation, ImpactLocation) <= LocationToleranceSquared)
+		{
+			return &Probe;
+		}
+	}
+
+	return nullptr;
+}
+
+void AALSXTCharacter::AddVaultingProbe(const FALSXTVaultingProbe& Probe)
+{
+	if (ALSXTSettings->Vaulting.ProbeCacheLifetime <= 0.0f || !Probe.TargetPrimitive.IsValid() ||
+	    Probe.TargetPrimitive->Mobility == EComponentMobility::Movable)
+	{
+		return;
+	}
+
+	VaultingProbes[VaultingProbeIndex] = Probe;
+	VaultingProbeIndex = (VaultingProbeIndex + 1) % VaultingProbeCacheSize;
+}
+
 void AALSXTCharacter::ServerStartVaulting_Implementation(const FALSXTVaultingParameters& Parameters)
 {
 	if (IsVaultingAllowedToStart(Parameters.VaultAnimation))
@@ -633,6 +743,16 @@ void AALSXTCharacter::StartVaultingImplementation(const FALSXTVaultingParameters
 	Vaulting->ActorFeetLocationOffset = ActorFeetLocationOffset;
 	Vaulting->ActorRotationOffset = ActorRotationOffset.Rotator();
 	Vaulting->VaultingHeight = Parameters.VaultingHeight;
+	Vaulting->VaultingState = VaultingState;
+	Vaulting->VaultAnimationIndex = VaultingSettings->VaultAnimations.IndexOfByKey(VaultingState.VaultingParameters.VaultAnimation);
+
+	if (Vaulting->VaultAnimationIndex == INDEX_NONE)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s: the vault animation %s is not in the vaulting settings %s, it will be replicated in full."),
+		       *GetName(), *GetNameSafe(VaultingState.VaultingParameters.VaultAnimation.Montage.Montage), *GetNameSafe(VaultingSettings));
+	}
+
+	Vaulting->BakeCurveTable();
 
 	VaultingRootMotionSourceId = GetCharacterMovement()->ApplyRootMotionSource(Vaulting);
 
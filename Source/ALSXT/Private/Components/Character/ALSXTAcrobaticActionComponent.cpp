@@ -3,7 +3,12 @@
 #include "Components/Character/ALSXTAcrobaticActionComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Utility/ALSXTGameplayTags.h"
-#include "Kismet/KismetSystemLibrary.h"
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/CollisionProfile.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Utility/ALSXTNetAccounting.h"
+#include "Utility/ALSXTStats.h"
 
 // Sets default values for this component's properties
 UALSXTAcrobaticActionComponent::UALSXTAcrobaticActionComponent()
@@ -22,7 +27,11 @@ void UALSXTAcrobaticActionComponent::BeginPlay()
 	Super::BeginPlay();
 
 	Character = Cast<AALSXTCharacter>(GetOwner());
-	
+
+	if (IsValid(Character))
+	{
+		Character->LandedDelegate.AddUniqueDynamic(this, &ThisClass::OnCharacterLanded);
+	}
 }
 
 
@@ -34,6 +43,14 @@ void UALSXTAcrobaticActionComponent::TickComponent(float DeltaTime, ELevelTick T
 	// ...
 }
 
+bool UALSXTAcrobaticActionComponent::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	ALSXTStats::RecordRpc(Function);
+	ALSXTNetAccounting::RecordRpc(*this, *Function, Parameters);
+
+	return Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+}
+
 void UALSXTAcrobaticActionComponent::TryAcrobaticAction()
 {
 	if (!GeneralAcrobaticActionSettings.bAcrobaticActions || Character->GetLocomotionMode() == AlsLocomotionModeTags::Grounded)
@@ -73,40 +90,15 @@ void UALSXTAcrobaticActionComponent::DetermineAcrobaticActionType(FGameplayTag&
 	{
 		return;
 	}
-	const auto* Capsule{ Character->GetCapsuleComponent() };
-	FVector ActorLocation = Character->GetActorLocation();
-	float CapsuleRadius = Capsule->GetScaledCapsuleRadius();
-	float CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
 	float Velocity = Character->GetVelocity().Size();
-	TArray<AActor*> ActorsToIgnore;
-
-	FVector ForwardTraceHalfSize {CapsuleRadius, (CapsuleRadius*1.25), CapsuleHalfHeight};
-	FVector LateralTraceHalfSize{ (CapsuleRadius * 1.25), CapsuleRadius, CapsuleHalfHeight };
-	FVector ForwardVector = Character->GetCapsuleComponent()->GetForwardVector();
-	FVector UpVector = Character->GetActorUpVector();
-	FVector DownTraceStartPoint = ActorLocation + (UpVector * -CapsuleHalfHeight * 2.0f);
-	FVector DownTraceEndPoint = DownTraceStartPoint + (UpVector * -GeneralAcrobaticActionSettings.DownTraceDistance);
-	FVector ForwardTraceStartLocation = ActorLocation + (ForwardVector * 50.0f);
-	FVector ForwardTraceEndLocation = ForwardTraceStartLocation + (ForwardVector * GeneralAcrobaticActionSettings.ForwardTraceDistance);
-
-	FVector RightVector = Character->GetCapsuleComponent()->GetRightVector();
-
-	FVector RightTraceStartLocation = ActorLocation + (RightVector * 50.0f) + (ForwardVector * -25.0f);
-	FVector RightTraceEndLocation = RightTraceStartLocation + (RightVector * GeneralAcrobaticActionSettings.LateralTraceDistance);
-	FVector LeftTraceStartLocation = ActorLocation + (RightVector * -50.0f) + (ForwardVector * -25.0f);
-	FVector LeftTraceEndLocation = LeftTraceStartLocation + (RightVector * -GeneralAcrobaticActionSettings.LateralTraceDistance);
-	
-	TArray<FHitResult> ForwardOutHits;
-	TArray<FHitResult> DownOutHits;
-	TArray<FHitResult> LeftOutHits;
-	TArray<FHitResult> RightOutHits;
-	
-	bool DownwardHit = UKismetSystemLibrary::BoxTraceMultiForObjects(GetWorld(), DownTraceStartPoint, DownTraceEndPoint, ForwardTraceHalfSize, Character->GetActorRotation(), GeneralAcrobaticActionSettings.TraceObjectTypes, false, ActorsToIgnore, EDrawDebugTrace::None, DownOutHits, true, FLinearColor::Red, FLinearColor::Green, GeneralAcrobaticActionSettings.DebugTraceDuration);
+
+	const auto& Probe{ProbeEnvironment()};
+	bool DownwardHit = Probe.bDownHit;
 	bool Falling = Character->GetVelocity().Z < 0.0;
 	bool HasEnoughSpaceForFlip = !DownwardHit || DownwardHit && !Falling;
-	bool ForwardHit = UKismetSystemLibrary::BoxTraceMultiForObjects(GetWorld(), ForwardTraceStartLocation, ForwardTraceEndLocation, ForwardTraceHalfSize, Character->GetActorRotation(), GeneralAcrobaticActionSettings.TraceObjectTypes, false, ActorsToIgnore, EDrawDebugTrace::None, ForwardOutHits, true, FLinearColor::Red, FLinearColor::Green, GeneralAcrobaticActionSettings.DebugTraceDuration);
-	bool LeftHit = UKismetSystemLibrary::BoxTraceMultiForObjects(GetWorld(), LeftTraceStartLocation, LeftTraceEndLocation, LateralTraceHalfSize, Character->GetActorRotation(), GeneralAcrobaticActionSettings.TraceObjectTypes, false, ActorsToIgnore, EDrawDebugTrace::None, LeftOutHits, true, FLinearColor::Red, FLinearColor::Green, GeneralAcrobaticActionSettings.DebugTraceDuration);
-	bool RightHit = UKismetSystemLibrary::BoxTraceMultiForObjects(GetWorld(), RightTraceStartLocation, RightTraceEndLocation, LateralTraceHalfSize, Character->GetActorRotation(), GeneralAcrobaticActionSettings.TraceObjectTypes, false, ActorsToIgnore, EDrawDebugTrace::None, RightOutHits, true, FLinearColor::Red, FLinearColor::Green, GeneralAcrobaticActionSettings.DebugTraceDuration);
+	bool ForwardHit = Probe.bForwardHit;
+	bool LeftHit = Probe.bLeftHit;
+	bool RightHit = Probe.bRightHit;
 
 	if (HasEnoughSpaceForFlip && (!ForwardHit && !LeftHit && !RightHit) || Velocity < GeneralAcrobaticActionSettings.MinimumSpeedForWallJump)
 	{
@@ -146,6 +138,113 @@ void UALSXTAcrobaticActionComponent::DetermineAcrobaticActionType(FGameplayTag&
 
 }
 
+const FALSXTAcrobaticEnvironmentProbe& UALSXTAcrobaticActionComponent::ProbeEnvironment()
+{
+	// The probe is reused for the rest of the air time, probes made while not falling, such as by blueprint
+	// calls while grounded, are only reused in the same frame so that they never leak into the next jump.
+
+	const auto bInAir{Character->GetCharacterMovement()->IsFalling()};
+
+	if (EnvironmentProbe.bValid && EnvironmentProbe.bInAir == bInAir && (bInAir || EnvironmentProbe.FrameNumber == GFrameCounter))
+	{
+		return EnvironmentProbe;
+	}
+
+	const auto* Capsule{Character->GetCapsuleComponent()};
+	const auto CapsuleRadius{Capsule->GetScaledCapsuleRadius()};
+	const auto CapsuleHalfHeight{Capsule->GetScaledCapsuleHalfHeight()};
+	const auto ActorTransform{Character->GetActorTransform()};
+	const auto ActorRotation{ActorTransform.GetRotation()};
+
+	// The down, forward, left and right volumes are boxes swept along the actor's axes, so each of
+	// them is an axis-aligned box in actor space and all of them fit into a single bounding box.
+
+	const auto ForwardDistance{GeneralAcrobaticActionSettings.ForwardTraceDistance};
+	const auto DownDistance{GeneralAcrobaticActionSettings.DownTraceDistance};
+	const auto LateralDistance{GeneralAcrobaticActionSettings.LateralTraceDistance};
+
+	const FBox DownVolume{
+		FVector{-CapsuleRadius, -CapsuleRadius * 1.25f, -CapsuleHalfHeight * 3.0f - DownDistance},
+		FVector{CapsuleRadius, CapsuleRadius * 1.25f, -CapsuleHalfHeight}
+	};
+
+	const FBox ForwardVolume{
+		FVector{50.0f - CapsuleRadius, -CapsuleRadius * 1.25f, -CapsuleHalfHeight},
+		FVector{50.0f + ForwardDistance + CapsuleRadius, CapsuleRadius * 1.25f, CapsuleHalfHeight}
+	};
+
+	const FBox RightVolume{
+		FVector{-25.0f - CapsuleRadius * 1.25f, 50.0f - CapsuleRadius, -CapsuleHalfHeight},
+		FVector{-25.0f + CapsuleRadius * 1.25f, 50.0f + LateralDistance + CapsuleRadius, CapsuleHalfHeight}
+	};
+
+	const FBox LeftVolume{
+		FVector{RightVolume.Min.X, -RightVolume.Max.Y, RightVolume.Min.Z},
+		FVector{RightVolume.Max.X, -RightVolume.Min.Y, RightVolume.Max.Z}
+	};
+
+	auto ProbeVolume{DownVolume};
+	ProbeVolume += ForwardVolume;
+	ProbeVolume += RightVolume;
+	ProbeVolume += LeftVolume;
+
+	FCollisionObjectQueryParams ObjectQueryParameters;
+	for (const auto ObjectType : GeneralAcrobaticActionSettings.TraceObjectTypes)
+	{
+		ObjectQueryParameters.AddObjectTypesToQuery(UCollisionProfile::Get()->ConvertToCollisionChannel(false, ObjectType));
+	}
+
+	static const FName ProbeTag{__FUNCTION__};
+
+	TArray<FOverlapResult> Overlaps;
+	GetWorld()->OverlapMultiByObjectType(Overlaps, ActorTransform.TransformPosition(ProbeVolume.GetCenter()), ActorRotation,
+	                                     ObjectQueryParameters, FCollisionShape::MakeBox(ProbeVolume.GetExtent()),
+	                                     {ProbeTag, false, Character});
+
+	EnvironmentProbe = {};
+	EnvironmentProbe.bValid = true;
+	EnvironmentProbe.bInAir = bInAir;
+	EnvironmentProbe.FrameNumber = GFrameCounter;
+
+	const auto ClassifyPrimitive{
+		[&ActorTransform, &ActorRotation](const UPrimitiveComponent& Primitive, const FBox& Volume)
+		{
+			// Reject the primitive cheaply by its bounds, only primitives whose bounds
+			// reach into the volume are tested against the volume's shape.
+
+			const auto VolumeBounds{Volume.TransformBy(ActorTransform)};
+			if (!Primitive.Bounds.GetBox().Intersect(VolumeBounds))
+			{
+				return false;
+			}
+
+			return Primitive.OverlapComponent(ActorTransform.TransformPosition(Volume.GetCenter()), ActorRotation,
+			                                  FCollisionShape::MakeBox(Volume.GetExtent()));
+		}
+	};
+
+	for (const auto& Overlap : Overlaps)
+	{
+		const auto* Primitive{Overlap.GetComponent()};
+		if (!IsValid(Primitive))
+		{
+			continue;
+		}
+
+		EnvironmentProbe.bDownHit |= !EnvironmentProbe.bDownHit && ClassifyPrimitive(*Primitive, DownVolume);
+		EnvironmentProbe.bForwardHit |= !EnvironmentProbe.bForwardHit && ClassifyPrimitive(*Primitive, ForwardVolume);
+		EnvironmentProbe.bLeftHit |= !EnvironmentProbe.bLeftHit && ClassifyPrimitive(*Primitive, LeftVolume);
+		EnvironmentProbe.bRightHit |= !EnvironmentProbe.bRightHit && ClassifyPrimitive(*Primitive, RightVolume);
+	}
+
+	return EnvironmentProbe;
+}
+
+void UALSXTAcrobaticActionComponent::OnCharacterLanded(const FHitResult& Hit)
+{
+	EnvironmentProbe.bValid = false;
+}
+
 void UALSXTAcrobaticActionComponent::BeginFlip()
 {
 	if (Character->GetLocalRole() == ROLE_AutonomousProxy)
@@ -5,8 +5,10 @@
 #include "Utility/ALSXTStructs.h"
 #include "Interfaces/ALSXTCharacterInterface.h"
 #include "Interfaces/ALSXTCharacterSoundComponentInterface.h"
-#include "NiagaraFunctionLibrary.h"
 #include "NiagaraComponent.h"
+#include "Subsystems/ALSXTEffectSpawnSubsystem.h"
+#include "Utility/ALSXTNetAccounting.h"
+#include "Utility/ALSXTStats.h"
 
 // Sets default values for this component's properties
 UALSXTCharacterSoundComponent::UALSXTCharacterSoundComponent()
@@ -29,6 +31,13 @@ void UALSXTCharacterSoundComponent::GetLifetimeReplicatedProps(TArray<FLifetimeP
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, WeaponActionAudioComponent, Parameters)
 }
 
+void UALSXTCharacterSoundComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	ALSXTNetAccounting::RecordReplicatedProperties(*this);
+}
+
 
 void UALSXTCharacterSoundComponent::BeginPlay()
 {
@@ -59,6 +68,14 @@ void UALSXTCharacterSoundComponent::TickComponent(float DeltaTime, ELevelTick Ti
 	}
 }
 
+bool UALSXTCharacterSoundComponent::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	ALSXTStats::RecordRpc(Function);
+	ALSXTNetAccounting::RecordRpc(*this, *Function, Parameters);
+
+	return Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+}
+
 void UALSXTCharacterSoundComponent::UpdateStaminaThresholds()
 {
 	float NewStaminaOptimalThreshold;
@@ -258,7 +275,21 @@ void UALSXTCharacterSoundComponent::PlayCharacterBreathEffects(const FGameplayTa
 
 void UALSXTCharacterSoundComponent::ServerPlayBreathParticle_Implementation(UNiagaraSystem* NiagaraSystem)
 {
-	UNiagaraComponent* NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAttached(NiagaraSystem, Character->GetMesh(), GeneralCharacterSoundSettings.VoiceSocketName, Character->GetMesh()->GetSocketLocation(GeneralCharacterSoundSettings.VoiceSocketName), Character->GetMesh()->GetSocketRotation(GeneralCharacterSoundSettings.VoiceSocketName), EAttachLocation::KeepWorldPosition, true, true, ENCPoolMethod::None, true);
+	SpawnBreathParticle(NiagaraSystem);
+}
+
+void UALSXTCharacterSoundComponent::SpawnBreathParticle(UNiagaraSystem* NiagaraSystem) const
+{
+	auto* EffectSpawnSubsystem{GetWorld()->GetSubsystem<UALSXTEffectSpawnSubsystem>()};
+	if (IsValid(EffectSpawnSubsystem))
+	{
+		auto* Mesh{Character->GetMesh()};
+
+		EffectSpawnSubsystem->SpawnSystemAttached(EALSXTEffectSpawnType::Breath, NiagaraSystem, Mesh, GeneralCharacterSoundSettings.VoiceSocketName,
+		                                          Mesh->GetSocketLocation(GeneralCharacterSoundSettings.VoiceSocketName),
+		                                          Mesh->GetSocketRotation(GeneralCharacterSoundSettings.VoiceSocketName),
+		                                          FVector::OneVector, EAttachLocation::KeepWorldPosition);
+	}
 }
 
 void UALSXTCharacterSoundComponent::StartTimeSinceLastCharacterMovementSoundTimer(const float Delay)
@@ -435,6 +466,8 @@ FGameplayTag UALSXTCharacterSoundComponent::ConvertStaminaToStaminaTag(const flo
 
 TArray<FALSXTBreathSound> UALSXTCharacterSoundComponent::SelectBreathSoundsNew(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Sex, const FGameplayTag& Variant, const FGameplayTag& BreathType, const FGameplayTag& Stamina)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_SoundSelection, GetOwner());
+
 	FGameplayTagContainer TagsContainer;
 	TArray<FALSXTBreathSound> BreathSounds = Settings->BreathSounds;
 	TArray<FALSXTBreathSound> FilteredBreathSounds;
@@ -553,6 +586,8 @@ UNiagaraSystem* UALSXTCharacterSoundComponent::DetermineNewBreathParticle()
 
 TArray<FALSXTBreathSound> UALSXTCharacterSoundComponent::SelectBreathSounds(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Sex, const FGameplayTag& Variant, const FGameplayTag& BreathType, const float Stamina)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_SoundSelection, GetOwner());
+
 	FGameplayTagContainer TagsContainer;
 	TArray<FALSXTBreathSound> BreathSounds = Settings->BreathSounds;
 	TArray<FALSXTBreathSound> FilteredBreathSounds;
@@ -596,6 +631,8 @@ TArray<FALSXTBreathSound> UALSXTCharacterSoundComponent::SelectBreathSounds(UALS
 
 TArray<FALSXTCharacterMovementSound> UALSXTCharacterSoundComponent::SelectCharacterMovementSounds(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Type, const FGameplayTag& Weight)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_SoundSelection, GetOwner());
+
 	TMap<TEnumAsByte<EPhysicalSurface>, FALSXTCharacterMovementSounds> MovementSoundsMap = SelectCharacterSoundSettings()->MovementSounds;
 	TEnumAsByte<EPhysicalSurface> FoundSurface;
 	IALSXTCharacterInterface::Execute_GetClothingSurfaceForMovement(Character, FoundSurface, Type);
@@ -638,6 +675,8 @@ TArray<FALSXTCharacterMovementSound> UALSXTCharacterSoundComponent::SelectCharac
 
 TArray<FALSXTCharacterMovementSound> UALSXTCharacterSoundComponent::SelectCharacterMovementAccentSounds(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Type, const FGameplayTag& Weight)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_SoundSelection, GetOwner());
+
 	TMap<TEnumAsByte<EPhysicalSurface>, FALSXTCharacterMovementSounds> MovementAccentSoundsMap = SelectCharacterSoundSettings()->MovementAccentSounds;
 	TEnumAsByte<EPhysicalSurface> AccentSurface;
 	IALSXTCharacterInterface::Execute_GetAccentSurfaceForMovement(Character, AccentSurface, Type);
@@ -678,6 +717,8 @@ TArray<FALSXTCharacterMovementSound> UALSXTCharacterSoundComponent::SelectCharac
 
 TArray<FALSXTWeaponMovementSound> UALSXTCharacterSoundComponent::SelectWeaponMovementSounds(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Weapon, const FGameplayTag& Type)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_SoundSelection, GetOwner());
+
 	TArray<FALSXTWeaponMovementSound> Sounds = SelectWeaponSoundSettings()->WeaponMovementSounds;
 	TArray<FALSXTWeaponMovementSound> FilteredSounds;
 	FGameplayTagContainer TagsContainer;
@@ -719,6 +760,8 @@ TArray<FALSXTWeaponMovementSound> UALSXTCharacterSoundComponent::SelectWeaponMov
 
 FALSXTWeaponActionSound UALSXTCharacterSoundComponent::SelectWeaponActionSound(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Type)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_SoundSelection, GetOwner());
+
 	TArray<FALSXTWeaponActionSound> Sounds = SelectWeaponSoundSettings()->WeaponActionSounds;
 	TArray<FALSXTWeaponActionSound> FilteredSounds;
 	FGameplayTagContainer TagsContainer;
@@ -784,6 +827,8 @@ FALSXTWeaponActionSound UALSXTCharacterSoundComponent::SelectWeaponActionSound(U
 
 TArray<FALSXTCharacterActionSound> UALSXTCharacterSoundComponent::SelectActionSounds(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Sex, const FGameplayTag& Variant, const FGameplayTag& Overlay, const FGameplayTag& Strength, const float Stamina)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_SoundSelection, GetOwner());
+
 	FGameplayTagContainer TagsContainer;
 	TArray<FALSXTCharacterActionSound> ActionSounds = Settings->ActionSounds;
 	TArray<FALSXTCharacterActionSound> FilteredActionSounds;
@@ -829,6 +874,8 @@ TArray<FALSXTCharacterActionSound> UALSXTCharacterSoundComponent::SelectActionSo
 
 TArray<FALSXTCharacterActionSound> UALSXTCharacterSoundComponent::SelectAttackSounds(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Sex, const FGameplayTag& Variant, const FGameplayTag& Overlay, const FGameplayTag& Strength, const float Stamina)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_SoundSelection, GetOwner());
+
 	FGameplayTagContainer TagsContainer;
 	TArray<FALSXTCharacterActionSound> AttackSounds = Settings->AttackSounds;
 	TArray<FALSXTCharacterActionSound> FilteredAttackSounds;
@@ -873,6 +920,8 @@ TArray<FALSXTCharacterActionSound> UALSXTCharacterSoundComponent::SelectAttackSo
 
 TArray<FALSXTCharacterDamageSound> UALSXTCharacterSoundComponent::SelectDamageSounds(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Sex, const FGameplayTag& Variant, const FGameplayTag& Overlay, const FGameplayTag& AttackMethod, const FGameplayTag& Form, const FGameplayTag& Strength)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_SoundSelection, GetOwner());
+
 	FGameplayTagContainer TagsContainer;
 	TArray<FALSXTCharacterDamageSound> DamageSounds = Settings->DamageSounds;
 	TArray<FALSXTCharacterDamageSound> FilteredDamageSounds;
@@ -920,6 +969,8 @@ TArray<FALSXTCharacterDamageSound> UALSXTCharacterSoundComponent::SelectDamageSo
 
 TArray<FALSXTCharacterDamageSound> UALSXTCharacterSoundComponent::SelectDeathSounds(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Sex, const FGameplayTag& Variant, const FGameplayTag& Overlay, const FGameplayTag& Form, const FGameplayTag& Strength)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_SoundSelection, GetOwner());
+
 	FGameplayTagContainer TagsContainer;
 	TArray<FALSXTCharacterDamageSound> DeathSounds = Settings->DeathSounds;
 	TArray<FALSXTCharacterDamageSound> FilteredDeathSounds;
@@ -1706,7 +1757,7 @@ void UALSXTCharacterSoundComponent::PlaySound(FMotionSounds MotionSounds)
 				{
 					UpdateVoiceSocketRotation();
 					UNiagaraSystem* NiagaraSystem{ (CurrentBreathParticles.Num() > 1) ? DetermineNewBreathParticle() : CurrentBreathParticles[0] };
-					UNiagaraComponent* NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAttached(NiagaraSystem, Character->GetMesh(), GeneralCharacterSoundSettings.VoiceSocketName, Character->GetMesh()->GetSocketLocation(GeneralCharacterSoundSettings.VoiceSocketName), Character->GetMesh()->GetSocketRotation(GeneralCharacterSoundSettings.VoiceSocketName), EAttachLocation::KeepWorldPosition, true, true, ENCPoolMethod::None, true);
+					SpawnBreathParticle(NiagaraSystem);
 					// ServerPlayBreathParticle(NiagaraSystem);
 				}
 			}
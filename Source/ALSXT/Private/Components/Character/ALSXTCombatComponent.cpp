@@ -14,8 +14,39 @@
 #include "GameFramework/Character.h"
 #include "ALSXTCharacter.h"
 #include "Interfaces/ALSXTTargetLockInterface.h"
+#include "Subsystems/ALSXTTargetLockSubsystem.h"
+#include "Algo/BinarySearch.h"
+#include "Materials/MaterialInstanceDynamic.h"
 #include "Interfaces/ALSXTCombatInterface.h"
 #include "Interfaces/ALSXTCharacterSoundComponentInterface.h"
+#include "Utility/ALSXTNetAccounting.h"
+#include "Utility/ALSXTStats.h"
+
+namespace ALSXTCombatComponent
+{
+	// Picks a random candidate, avoiding the last selected one when there is another candidate.
+	int32 SelectAnimationIndex(const TArray<int32>& Candidates, const int32 LastIndex)
+	{
+		if (Candidates.Num() <= 1)
+		{
+			return Candidates.Num() > 0 ? Candidates[0] : INDEX_NONE;
+		}
+
+		const auto LastCandidate{Candidates.Find(LastIndex)};
+		if (LastCandidate == INDEX_NONE)
+		{
+			return Candidates[FMath::RandHelper(Candidates.Num())];
+		}
+
+		auto Candidate{FMath::RandHelper(Candidates.Num() - 1)};
+		if (Candidate >= LastCandidate)
+		{
+			Candidate++;
+		}
+
+		return Candidates[Candidate];
+	}
+}
 
 // Sets default values for this component's properties
 UALSXTCombatComponent::UALSXTCombatComponent()
@@ -23,6 +54,7 @@ UALSXTCombatComponent::UALSXTCombatComponent()
 	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
 	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 	SetIsReplicatedByDefault(true);
 
 	// ...
@@ -43,7 +75,7 @@ void UALSXTCombatComponent::BeginPlay()
 		//FSetupPlayerInputComponentDelegate Del = Character->OnSetupPlayerInputComponentUpdated;
 		//Del.AddUniqueDynamic(this, &UALSXTCombatComponent::SetupInputComponent(EnhancedInput));
 	}
-	TargetTraceTimerDelegate.BindUFunction(this, "TryTraceForTargets");
+	TargetObstructionTraceDelegate.BindUObject(this, &ThisClass::OnTargetObstructionTraceCompleted);
 }
 
 
@@ -51,7 +83,57 @@ void UALSXTCombatComponent::BeginPlay()
 void UALSXTCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	RefreshAttack(DeltaTime);
+
+	if (bAttackActive)
+	{
+		RefreshAttack(DeltaTime);
+	}
+
+	if (bTargetLockActive)
+	{
+		RefreshTargetCandidates();
+		RefreshTargetLock(DeltaTime);
+	}
+}
+
+bool UALSXTCombatComponent::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	ALSXTStats::RecordRpc(Function);
+	ALSXTNetAccounting::RecordRpc(*this, *Function, Parameters);
+
+	return Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+}
+
+void UALSXTCombatComponent::RefreshTickEnabled()
+{
+	SetComponentTickEnabled(bAttackActive || bTargetLockActive);
+}
+
+void UALSXTCombatComponent::RefreshTargetLock(const float DeltaTime)
+{
+	if (!bTargetLockActive)
+	{
+		return;
+	}
+
+	// Only the target validation and the obstruction traces are rate limited. Drop the accumulated
+	// time instead of catching up, so the target lock is validated at most once per frame.
+
+	TargetLockUpdateTime += DeltaTime;
+	if (TargetLockUpdateTime >= CombatSettings.TargetLockUpdateInterval)
+	{
+		TargetLockUpdateTime = 0.0f;
+		TryTraceForTargets();
+	}
+
+	// Rotate every frame, so the camera follows the target smoothly at any frame rate. Don't turn toward a newly
+	// selected target before its line of sight is confirmed, otherwise the character would snap toward targets
+	// behind walls until the trace returns.
+
+	if (CurrentTarget.Valid && VisibleTarget == CurrentTarget.HitResult.GetActor())
+	{
+		RotatePlayerToTarget(CurrentTarget);
+	}
 }
 
 float UALSXTCombatComponent::GetAngle(FVector Target)
@@ -114,33 +196,35 @@ bool UALSXTCombatComponent::IsTartgetObstructed()
 
 void UALSXTCombatComponent::TryTraceForTargets()
 {
-	TArray<FGameplayTag> TargetableOverlayModes;
-	GetTargetableOverlayModes(TargetableOverlayModes);
+	if (TargetableOverlayModesCache.IsEmpty())
+	{
+		GetTargetableOverlayModes(TargetableOverlayModesCache);
+	}
 
-	if (Character && TargetableOverlayModes.Contains(Character->GetOverlayMode()) && Character->IsDesiredAiming() && IsValid(CurrentTarget.HitResult.GetActor()))
+	if (Character && TargetableOverlayModesCache.Contains(Character->GetOverlayMode()) && Character->IsDesiredAiming() && IsValid(CurrentTarget.HitResult.GetActor()))
 	{
 		if (Character->GetDistanceTo(CurrentTarget.HitResult.GetActor()) < CombatSettings.MaxInitialLockDistance)
-		{			
-			if (CombatSettings.UnlockWhenTargetIsObstructed && !CombatSettings.ObstructionTraceObjectTypes.IsEmpty()) {
-				if (CombatSettings.UnlockWhenTargetIsObstructed && !IsTartgetObstructed()) {
-					if (CurrentTarget.Valid)
-					{
-						RotatePlayerToTarget(CurrentTarget);
-					}
-				}
-				else
-				{
-					DisengageAllTargets();
-					OnTargetObstructed();
-				}
+		{
+			if (!CombatSettings.UnlockWhenTargetIsObstructed || CombatSettings.ObstructionTraceObjectTypes.IsEmpty())
+			{
+				VisibleTarget = CurrentTarget.HitResult.GetActor();
 			}
-			else
+			else if (!bTargetObstructionTracePending)
 			{
-				if (CurrentTarget.Valid)
-				{
-					RotatePlayerToTarget(CurrentTarget);
-				}
-			}			
+				// The obstruction result arrives next frame, see OnTargetObstructionTraceCompleted().
+
+				FCollisionQueryParams CollisionQueryParameters;
+				CollisionQueryParameters.AddIgnoredActor(GetOwner());
+				CollisionQueryParameters.AddIgnoredActor(CurrentTarget.HitResult.GetActor());
+
+				GetWorld()->AsyncLineTraceByObjectType(EAsyncTraceType::Single, Character->GetActorLocation(),
+				                                       CurrentTarget.HitResult.GetActor()->GetActorLocation(),
+				                                       TargetObstructionObjectQueryParameters, CollisionQueryParameters,
+				                                       &TargetObstructionTraceDelegate);
+
+				bTargetObstructionTracePending = true;
+				TargetObstructionTraceActor = CurrentTarget.HitResult.GetActor();
+			}
 		}
 		else
 		{
@@ -149,8 +233,36 @@ void UALSXTCombatComponent::TryTraceForTargets()
 	}
 }
 
+void UALSXTCombatComponent::OnTargetObstructionTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	bTargetObstructionTracePending = false;
+
+	// Ignore results for a target that is no longer the current one.
+
+	if (!bTargetLockActive || !TargetObstructionTraceActor.IsValid() ||
+	    TargetObstructionTraceActor != CurrentTarget.HitResult.GetActor())
+	{
+		return;
+	}
+
+	if (TraceDatum.OutHits.Num() > 0 && TraceDatum.OutHits[0].bBlockingHit)
+	{
+		DisengageAllTargets();
+		OnTargetObstructed();
+		return;
+	}
+
+	VisibleTarget = TargetObstructionTraceActor;
+}
+
 void UALSXTCombatComponent::TraceForTargets(TArray<FTargetHitResultEntry>& Targets)
 {
+	auto* TargetLock{GetWorld()->GetSubsystem<UALSXTTargetLockSubsystem>()};
+	if (!IsValid(TargetLock))
+	{
+		return;
+	}
+
 	FRotator ControlRotation = Character->GetControlRotation();
 	FVector CharLoc = Character->GetActorLocation();
 	FVector ForwardVector = Character->GetActorForwardVector();
@@ -158,8 +270,6 @@ void UALSXTCombatComponent::TraceForTargets(TArray<FTargetHitResultEntry>& Targe
 	FVector StartLocation = ForwardVector * 150 + CameraLocation;
 	FVector EndLocation = ForwardVector * 200 + StartLocation;
 	FVector CenterLocation = (StartLocation - EndLocation) / 8 + StartLocation;
-	FCollisionShape CollisionShape = FCollisionShape::MakeBox(CombatSettings.TraceAreaHalfSize);
-	TArray<FHitResult> OutHits;
 
 	// Display Debug Shape
 	if (CombatSettings.DebugMode)
@@ -167,39 +277,95 @@ void UALSXTCombatComponent::TraceForTargets(TArray<FTargetHitResultEntry>& Targe
 		DrawDebugBox(GetWorld(), CenterLocation, CombatSettings.TraceAreaHalfSize, ControlRotation.Quaternion(), FColor::Yellow, false, CombatSettings.DebugDuration, 100, 2);
 	}
 
-	FCollisionObjectQueryParams ObjectQueryParameters;
-	for (const auto ObjectType : CombatSettings.TargetTraceObjectTypes)
-	{
-		ObjectQueryParameters.AddObjectTypesToQuery(UCollisionProfile::Get()->ConvertToCollisionChannel(false, ObjectType));
-	}
+	TArray<AActor*> Actors;
+	TargetLock->GatherTargets(CharLoc, CombatSettings.MaxLockDistance, Actors);
 
-	bool isHit = GetWorld()->SweepMultiByObjectType(OutHits, StartLocation, EndLocation, ControlRotation.Quaternion(), ObjectQueryParameters, CollisionShape);
+	const auto ControlQuaternion{ControlRotation.Quaternion()};
+	const auto SweepDelta{EndLocation - StartLocation};
+	const auto SweepLengthSquared{FMath::Max(SweepDelta.SizeSquared(), UE_SMALL_NUMBER)};
 
-	if (isHit)
+	for (auto* Actor : Actors)
 	{
-		for (auto& Hit : OutHits)
+		if (Actor == Character)
 		{
-			if (Hit.GetActor()->GetClass()->ImplementsInterface(UALSXTTargetLockInterface::StaticClass()) && Hit.GetActor() != Character && Character->GetDistanceTo(Hit.GetActor()) < CombatSettings.MaxLockDistance)
-			{
-				FTargetHitResultEntry HitResultEntry;
-				HitResultEntry.Valid = true;
-				HitResultEntry.DistanceFromPlayer = FVector::Distance(Character->GetActorLocation(), Hit.Location);
-				HitResultEntry.AngleFromCenter = GetAngle(Hit.Location);
-				HitResultEntry.HitResult = Hit;
-				Targets.Add(HitResultEntry);
-			}
+			continue;
 		}
+
+		// Keep the area of the former box sweep, the target must be inside
+		// the box placed at the closest point of the sweep to the target.
+
+		const auto TargetLocation{Actor->GetActorLocation()};
+		const auto SweepAlpha{FMath::Clamp(((TargetLocation - StartLocation) | SweepDelta) / SweepLengthSquared, 0.0, 1.0)};
+		const auto LocalLocation{ControlQuaternion.UnrotateVector(TargetLocation - (StartLocation + SweepDelta * SweepAlpha))};
+
+		if (FMath::Abs(LocalLocation.X) > CombatSettings.TraceAreaHalfSize.X ||
+		    FMath::Abs(LocalLocation.Y) > CombatSettings.TraceAreaHalfSize.Y ||
+		    FMath::Abs(LocalLocation.Z) > CombatSettings.TraceAreaHalfSize.Z)
+		{
+			continue;
+		}
+
+		FTargetHitResultEntry HitResultEntry;
+		HitResultEntry.Valid = true;
+		HitResultEntry.DistanceFromPlayer = FVector::Distance(CharLoc, TargetLocation);
+		HitResultEntry.AngleFromCenter = GetAngle(TargetLocation);
+		HitResultEntry.HitResult = FHitResult{
+			Actor, Cast<UPrimitiveComponent>(Actor->GetRootComponent()), TargetLocation, (CharLoc - TargetLocation).GetSafeNormal()
+		};
+		Targets.Add(HitResultEntry);
 	}
 }
 
+void UALSXTCombatComponent::RefreshTargetCandidates()
+{
+	const auto Time{GetWorld()->GetTimeSeconds()};
+	if (TargetCandidatesRefreshTime >= 0.0 && Time - TargetCandidatesRefreshTime < CombatSettings.TargetCandidatesRefreshInterval)
+	{
+		return;
+	}
+
+	TargetCandidatesRefreshTime = Time;
+
+	TargetCandidates.Reset();
+	TraceForTargets(TargetCandidates);
+
+	TargetCandidates.Sort([](const FTargetHitResultEntry& A, const FTargetHitResultEntry& B)
+	{
+		return A.AngleFromCenter < B.AngleFromCenter;
+	});
+}
+
+int32 UALSXTCombatComponent::FindTargetCandidateIndex(const FTargetHitResultEntry& Target) const
+{
+	const auto* TargetActor{Target.HitResult.GetActor()};
+	if (TargetActor == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	return TargetCandidates.IndexOfByPredicate([TargetActor](const FTargetHitResultEntry& Candidate)
+	{
+		return Candidate.HitResult.GetActor() == TargetActor;
+	});
+}
+
 void UALSXTCombatComponent::GetClosestTarget()
 {
-	TArray<FTargetHitResultEntry> OutHits;
-	TraceForTargets(OutHits);
+	RefreshTargetCandidates();
+	const auto& OutHits{TargetCandidates};
+	const auto bPreviousTargetLockActive{bTargetLockActive};
 	FTargetHitResultEntry FoundHit;
 	TArray<FGameplayTag> TargetableOverlayModes;
 	GetTargetableOverlayModes(TargetableOverlayModes);
 
+	TargetableOverlayModesCache = TargetableOverlayModes;
+
+	TargetObstructionObjectQueryParameters = {};
+	for (const auto ObjectType : CombatSettings.ObstructionTraceObjectTypes)
+	{
+		TargetObstructionObjectQueryParameters.AddObjectTypesToQuery(UCollisionProfile::Get()->ConvertToCollisionChannel(false, ObjectType));
+	}
+
 	if (TargetableOverlayModes.Contains(Character->GetOverlayMode()) && Character->IsDesiredAiming())
 	{
 		for (auto& Hit : OutHits)
@@ -224,10 +390,15 @@ void UALSXTCombatComponent::GetClosestTarget()
 							FoundHit = Hit;
 						}
 					}
-					GetWorld()->GetTimerManager().SetTimer(TargetTraceTimerHandle, TargetTraceTimerDelegate, 0.001f, true);
+					bTargetLockActive = true;
 				}
 			}
 		}
+		if (bTargetLockActive != bPreviousTargetLockActive)
+		{
+			RefreshTickEnabled();
+		}
+
 		if (FoundHit.Valid && FoundHit.HitResult.GetActor())
 		{
 			SetCurrentTarget(FoundHit);
@@ -247,25 +418,46 @@ void UALSXTCombatComponent::SetCurrentTarget(const FTargetHitResultEntry& NewTar
 	ClearCurrentTarget();
 	CurrentTarget = NewTarget;
 	OnNewTarget(NewTarget);
-	USkeletalMeshComponent* HitMesh;
 	AALSXTCharacter* ALSXTChar = Cast<AALSXTCharacter>(CurrentTarget.HitResult.GetActor());
 
 	if (ALSXTChar)
 	{
-		HitMesh = ALSXTChar->GetMesh();
-		TArray<UMaterialInterface*> CharMaterials = HitMesh->GetMaterials();
+		HighlightedTargetMesh = ALSXTChar->GetMesh();
+		SetTargetMeshHighlighted(HighlightedTargetMesh.Get(), true);
+	}	
+}
 
-		if (CharMaterials[0])
+void UALSXTCombatComponent::SetTargetMeshHighlighted(UMeshComponent* Mesh, const bool bHighlighted) const
+{
+	if (!IsValid(Mesh))
+	{
+		return;
+	}
+
+	const auto HighlightValue{bHighlighted ? 1.0f : 0.0f};
+
+	if (CombatSettings.HighlightCustomPrimitiveDataIndex >= 0)
+	{
+		Mesh->SetCustomPrimitiveDataFloat(CombatSettings.HighlightCustomPrimitiveDataIndex, HighlightValue);
+		return;
+	}
+
+	// The dynamic material instances stay on the mesh after the highlight is removed, so that locking the same
+	// target again reuses them, since CreateAndSetMaterialInstanceDynamic() returns the existing instance.
+
+	for (auto i{0}; i < Mesh->GetNumMaterials(); i++)
+	{
+		auto* Material{
+			bHighlighted
+				? Mesh->CreateAndSetMaterialInstanceDynamic(i)
+				: Cast<UMaterialInstanceDynamic>(Mesh->GetMaterial(i))
+		};
+
+		if (IsValid(Material))
 		{
-			for (int m = 0; m < CharMaterials.Num(); m++)
-			{
-				UMaterialInstanceDynamic* CharDynMaterial = HitMesh->CreateAndSetMaterialInstanceDynamic(m);
-				CharDynMaterial->SetScalarParameterValue(CombatSettings.HighlightMaterialParameterName, 1.0f);
-				HitMesh->SetMaterial(m, CharDynMaterial);
-				TargetDynamicMaterials.Add(CharDynMaterial);
-			}
+			Material->SetScalarParameterValue(CombatSettings.HighlightMaterialParameterName, HighlightValue);
 		}
-	}	
+	}
 }
 
 void UALSXTCombatComponent::ClearCurrentTarget()
@@ -276,20 +468,10 @@ void UALSXTCombatComponent::ClearCurrentTarget()
 		CurrentTarget.DistanceFromPlayer = 340282346638528859811704183484516925440.0f;
 		CurrentTarget.AngleFromCenter = 361.0f;
 
-		if (Cast<AALSXTCharacter>(CurrentTarget.HitResult.GetActor()))
-		{
-			USkeletalMeshComponent* HitMesh = Cast<AALSXTCharacter>(CurrentTarget.HitResult.GetActor())->GetMesh();
-			TArray<UMaterialInterface*> CharMaterials = HitMesh->GetMaterials();
-			if (TargetDynamicMaterials[0])
-			{
-				for (int m = 0; m < TargetDynamicMaterials.Num(); m++)
-				{
-					TargetDynamicMaterials[m]->SetScalarParameterValue(CombatSettings.HighlightMaterialParameterName, 0.0f);
-					// HitMesh->SetMaterial(m, CharDynMaterial);
-				}
-				TargetDynamicMaterials.Empty();
-			}
-		}
+		SetTargetMeshHighlighted(HighlightedTargetMesh.Get(), false);
+		HighlightedTargetMesh.Reset();
+		VisibleTarget.Reset();
+
 		CurrentTarget.HitResult = FHitResult(ForceInit);
 	}
 }
@@ -298,68 +480,59 @@ void UALSXTCombatComponent::DisengageAllTargets()
 {
 	ClearCurrentTarget();
 
-	// Clear Trace Timer
-	GetWorld()->GetTimerManager().ClearTimer(TargetTraceTimerHandle);
+	bTargetLockActive = false;
+	TargetLockUpdateTime = 0.0f;
+
+	RefreshTickEnabled();
 }
 
 void UALSXTCombatComponent::GetTargetLeft()
 {
-	TArray<FTargetHitResultEntry> OutHits;
-	TraceForTargets(OutHits);
+	RefreshTargetCandidates();
 	FTargetHitResultEntry FoundHit;
 	TArray<FGameplayTag> TargetableOverlayModes;
 	GetTargetableOverlayModes(TargetableOverlayModes);
 
 	if (TargetableOverlayModes.Contains(Character->GetOverlayMode()) && Character->IsDesiredAiming())
 	{
-		for (auto& Hit : OutHits)
+		// The candidate with the next smaller angle than the current target.
+
+		auto CurrentIndex{FindTargetCandidateIndex(CurrentTarget)};
+		if (CurrentIndex == INDEX_NONE)
 		{
-			if (Hit.HitResult.GetActor() != CurrentTarget.HitResult.GetActor() && (Hit.AngleFromCenter < CurrentTarget.AngleFromCenter))
-			{
-				if (!FoundHit.Valid)
-				{
-					FoundHit = Hit;
-				}
-				else
-				{
-					if (Hit.AngleFromCenter > FoundHit.AngleFromCenter)
-					{
-						FoundHit = Hit;
-					}
-				}
-			}
+			CurrentIndex = Algo::LowerBoundBy(TargetCandidates, CurrentTarget.AngleFromCenter, &FTargetHitResultEntry::AngleFromCenter);
+		}
+
+		if (TargetCandidates.IsValidIndex(CurrentIndex - 1))
+		{
+			FoundHit = TargetCandidates[CurrentIndex - 1];
 		}
+
 		SetCurrentTarget(FoundHit);
 	}
 }
 
 void UALSXTCombatComponent::GetTargetRight()
 {
-	TArray<FTargetHitResultEntry> OutHits;
-	TraceForTargets(OutHits);
+	RefreshTargetCandidates();
 	FTargetHitResultEntry FoundHit;
 	TArray<FGameplayTag> TargetableOverlayModes;
 	GetTargetableOverlayModes(TargetableOverlayModes);
 
 	if (TargetableOverlayModes.Contains(Character->GetOverlayMode()) && Character->IsDesiredAiming())
 	{
-		for (auto& Hit : OutHits)
+		// The candidate with the next greater angle than the current target.
+
+		auto NextIndex{FindTargetCandidateIndex(CurrentTarget)};
+		NextIndex = NextIndex != INDEX_NONE
+			            ? NextIndex + 1
+			            : Algo::UpperBoundBy(TargetCandidates, CurrentTarget.AngleFromCenter, &FTargetHitResultEntry::AngleFromCenter);
+
+		if (TargetCandidates.IsValidIndex(NextIndex))
 		{
-			if (Hit.HitResult.GetActor() != CurrentTarget.HitResult.GetActor() && (Hit.AngleFromCenter > CurrentTarget.AngleFromCenter))
-			{
-				if (!FoundHit.Valid)
-				{
-					FoundHit = Hit;
-				}
-				else
-				{
-					if (Hit.AngleFromCenter < FoundHit.AngleFromCenter)
-					{
-						FoundHit = Hit;
-					}
-				}
-			}
+			FoundHit = TargetCandidates[NextIndex];
 		}
+
 		SetCurrentTarget(FoundHit);
 	}
 }
@@ -540,6 +713,31 @@ void UALSXTCombatComponent::StartAttack(const FGameplayTag& AttackType, const FG
 		return;
 	}
 
+	// The animation index is replicated instead of the montage. Blueprint overrides of SelectAttackMontage
+	// don't update the last selected index, so fall back to looking the montage up.
+
+	const auto* Settings{SelectAttackSettings()};
+	if (!IsValid(Settings))
+	{
+		return;
+	}
+
+	auto AttackAnimationIndex{LastAttackAnimationIndex};
+
+	if (!Settings->AttackAnimations.IsValidIndex(AttackAnimationIndex) ||
+	    Settings->AttackAnimations[AttackAnimationIndex].Montage.Montage != Montage.Montage.Montage)
+	{
+		AttackAnimationIndex = Settings->AttackAnimations.IndexOfByPredicate([&Montage](const FAttackAnimation& AttackAnimation)
+		{
+			return AttackAnimation.Montage.Montage == Montage.Montage.Montage;
+		});
+
+		if (AttackAnimationIndex == INDEX_NONE)
+		{
+			return;
+		}
+	}
+
 	const auto StartYawAngle{ UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(Character->GetActorRotation().Yaw)) };
 
 	// Clear the character movement mode and set the locomotion action to mantling.
@@ -547,6 +745,9 @@ void UALSXTCombatComponent::StartAttack(const FGameplayTag& AttackType, const FG
 	Character->SetMovementModeLocked(true);
 	// Character->GetCharacterMovement()->SetMovementMode(MOVE_Custom);
 
+	bAttackActive = true;
+	RefreshTickEnabled();
+
 	if (Character->GetLocalRole() >= ROLE_Authority)
 	{
 		// Character->GetCharacterMovement()->NetworkSmoothingMode = ENetworkSmoothingMode::Disabled;
@@ -562,13 +763,13 @@ void UALSXTCombatComponent::StartAttack(const FGameplayTag& AttackType, const FG
 		FALSXTCombatState NewCombatState;
 		NewCombatState.CombatParameters = CombatParameters;
 		SetCombatState(NewCombatState);
-		MulticastStartAttack(Montage.Montage.Montage, PlayRate, StartYawAngle, TargetYawAngle);
+		MulticastStartAttack(AttackAnimationIndex, PlayRate, StartYawAngle, TargetYawAngle);
 	}
 	else
 	{
 		Character->GetCharacterMovement()->FlushServerMoves();
 
-		ServerStartAttack(Montage.Montage.Montage, PlayRate, StartYawAngle, TargetYawAngle);
+		ServerStartAttack(AttackAnimationIndex, PlayRate, StartYawAngle, TargetYawAngle);
 		OnAttackStarted(AttackType, Stance, Strength, BaseDamage);
 	}
 }
@@ -588,6 +789,11 @@ void UALSXTCombatComponent::StartSyncedAttack(const FGameplayTag& Overlay, const
 		return;
 	}
 
+	if (GetSyncedAttackMontageByIndex(SelectSyncedAttackMontageIndex) != Montage.SyncedMontage.InstigatorSyncedMontage.Montage)
+	{
+		return;
+	}
+
 	// GetSyncedAttackMontage();
 
 	const auto StartYawAngle{ UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(Character->GetActorRotation().Yaw)) };
@@ -597,6 +803,9 @@ void UALSXTCombatComponent::StartSyncedAttack(const FGameplayTag& Overlay, const
 	Character->SetMovementModeLocked(true);
 	// Character->GetCharacterMovement()->SetMovementMode(MOVE_Custom);
 
+	bAttackActive = true;
+	RefreshTickEnabled();
+
 	if (Character->GetLocalRole() >= ROLE_Authority)
 	{
 		// Character->GetCharacterMovement()->NetworkSmoothingMode = ENetworkSmoothingMode::Disabled;
@@ -612,14 +821,14 @@ void UALSXTCombatComponent::StartSyncedAttack(const FGameplayTag& Overlay, const
 		FALSXTCombatState NewCombatState;
 		NewCombatState.CombatParameters = CombatParameters;
 		SetCombatState(NewCombatState);
-		MulticastStartSyncedAttack(Montage.SyncedMontage.InstigatorSyncedMontage.Montage, SelectSyncedAttackMontageIndex, PlayRate, StartYawAngle, TargetYawAngle);
+		MulticastStartSyncedAttack(SelectSyncedAttackMontageIndex, PlayRate, StartYawAngle, TargetYawAngle);
 	}
 	else
 	{
 		Character->GetCharacterMovement()->FlushServerMoves();
 
-		StartSyncedAttackImplementation(Montage.SyncedMontage.InstigatorSyncedMontage.Montage, SelectSyncedAttackMontageIndex, PlayRate, StartYawAngle, TargetYawAngle);
-		ServerStartSyncedAttack(Montage.SyncedMontage.InstigatorSyncedMontage.Montage, SelectSyncedAttackMontageIndex, PlayRate, StartYawAngle, TargetYawAngle);
+		StartSyncedAttackImplementation(SelectSyncedAttackMontageIndex, PlayRate, StartYawAngle, TargetYawAngle);
+		ServerStartSyncedAttack(SelectSyncedAttackMontageIndex, PlayRate, StartYawAngle, TargetYawAngle);
 		OnSyncedAttackStarted(AttackType, Stance, Strength, BaseDamage);
 	}
 }
@@ -728,138 +937,44 @@ void UALSXTCombatComponent::DetermineAttackMethod_Implementation(FGameplayTag& A
 
 FAttackAnimation UALSXTCombatComponent::SelectAttackMontage_Implementation(const FGameplayTag& AttackType, const FGameplayTag& Stance, const FGameplayTag& Strength, const float BaseDamage)
 {
-	FAttackAnimation SelectedAttackAnimation;
-	UALSXTCombatSettings* Settings = SelectAttackSettings();
-	TArray<FAttackAnimation> Montages = Settings->AttackAnimations;
-	TArray<FAttackAnimation> FilteredMontages;
-	TArray<FGameplayTag> TagsArray = { AttackType, Stance, Strength };
-	FGameplayTagContainer TagsContainer = FGameplayTagContainer::CreateFromArray(TagsArray);
-	
-	// Return is there are no Montages
-	if (Montages.Num() < 1 || !Montages[0].Montage.Montage)
+	const auto* Settings{SelectAttackSettings()};
+	if (!IsValid(Settings))
 	{
-		return SelectedAttackAnimation;
+		return {};
 	}
 
-	// Filter sounds based on Tag parameters
-	for (auto Montage : Montages)
-	{
-		FGameplayTagContainer CurrentTagsContainer;
-		CurrentTagsContainer.AppendTags(Montage.AttackStrengths);
-		CurrentTagsContainer.AppendTags(Montage.AttackStances);
-		CurrentTagsContainer.AppendTags(Montage.AttackType);
-
-		if (CurrentTagsContainer.HasAll(TagsContainer))
-		{
-			FilteredMontages.Add(Montage);
-		}
-	}
+	const auto& Candidates{Settings->GetAttackAnimationIndices({AttackType, Stance, Strength})};
+	const auto Index{ALSXTCombatComponent::SelectAnimationIndex(Candidates, LastAttackAnimationIndex)};
 
-	// Return if there are no filtered sounds
-	if (FilteredMontages.Num() < 1 || !FilteredMontages[0].Montage.Montage)
+	if (Index == INDEX_NONE)
 	{
-		return SelectedAttackAnimation;
+		return {};
 	}
 
-	// If more than one result, avoid duplicates
-	if (FilteredMontages.Num() > 1)
-	{
-		// If FilteredMontages contains LastAttackAnimation, remove it from FilteredMontages array to avoid duplicates
-		if (FilteredMontages.Contains(LastAttackAnimation))
-		{
-			int IndexToRemove = FilteredMontages.Find(LastAttackAnimation);
-			FilteredMontages.RemoveAt(IndexToRemove, 1, true);
-		}
-
-		//Shuffle Array
-		for (int m = FilteredMontages.Num() - 1; m >= 0; --m)
-		{
-			int n = FMath::Rand() % (m + 1);
-			if (m != n) FilteredMontages.Swap(m, n);
-		}
-		
-		// Select Random Array Entry
-		int RandIndex = FMath::RandRange(0, (FilteredMontages.Num() - 1));
-		SelectedAttackAnimation = FilteredMontages[RandIndex];
-		LastAttackAnimation = SelectedAttackAnimation;
-		return SelectedAttackAnimation;
-	}
-	else
-	{
-		SelectedAttackAnimation = FilteredMontages[0];
-		LastAttackAnimation = SelectedAttackAnimation;
-		return SelectedAttackAnimation;
-	}
-	return SelectedAttackAnimation;
+	LastAttackAnimationIndex = Index;
+	return Settings->AttackAnimations[Index];
 }
 
 FSyncedAttackAnimation UALSXTCombatComponent::SelectSyncedAttackMontage_Implementation(const FGameplayTag& AttackType, const FGameplayTag& Stance, const FGameplayTag& Strength, const float BaseDamage, int& Index)
 {
-	FSyncedAttackAnimation SelectedSyncedAttackAnimation;
-	UALSXTCombatSettings* Settings = SelectAttackSettings();
-	TArray<FSyncedAttackAnimation> Montages = Settings->SyncedAttackAnimations;
-	TArray<FSyncedAttackAnimation> FilteredMontages;
-	TArray<FGameplayTag> TagsArray = { AttackType, Stance, Strength };
-	FGameplayTagContainer TagsContainer = FGameplayTagContainer::CreateFromArray(TagsArray);
+	Index = INDEX_NONE;
 
-	// Return is there are no Montages
-	if (Montages.Num() < 1 || !Montages[0].SyncedMontage.InstigatorSyncedMontage.Montage)
+	const auto* Settings{SelectAttackSettings()};
+	if (!IsValid(Settings))
 	{
-		return SelectedSyncedAttackAnimation;
+		return {};
 	}
 
-	// Filter sounds based on Tag parameters
-	for (auto Montage : Montages)
-	{
-		FGameplayTagContainer CurrentTagsContainer;
-		CurrentTagsContainer.AppendTags(Montage.AttackStrength);
-		CurrentTagsContainer.AppendTags(Montage.AttackStance);
-		CurrentTagsContainer.AppendTags(Montage.AttackType);
-
-		if (CurrentTagsContainer.HasAll(TagsContainer))
-		{
-			FilteredMontages.Add(Montage);
-		}
-	}
+	const auto& Candidates{Settings->GetSyncedAttackAnimationIndices({AttackType, Stance, Strength})};
+	Index = ALSXTCombatComponent::SelectAnimationIndex(Candidates, LastSyncedAttackAnimationIndex);
 
-	// Return if there are no filtered sounds
-	if (FilteredMontages.Num() < 1 || !FilteredMontages[0].SyncedMontage.InstigatorSyncedMontage.Montage)
+	if (Index == INDEX_NONE)
 	{
-		return SelectedSyncedAttackAnimation;
+		return {};
 	}
 
-	// If more than one result, avoid duplicates
-	if (FilteredMontages.Num() > 1)
-	{
-		// If FilteredMontages contains LastAttackAnimation, remove it from FilteredMontages array to avoid duplicates
-		if (FilteredMontages.Contains(LastSyncedAttackAnimation))
-		{
-			int IndexToRemove = FilteredMontages.Find(LastSyncedAttackAnimation);
-			FilteredMontages.RemoveAt(IndexToRemove, 1, true);
-		}
-
-		//Shuffle Array
-		for (int m = FilteredMontages.Num() - 1; m >= 0; --m)
-		{
-			int n = FMath::Rand() % (m + 1);
-			if (m != n) FilteredMontages.Swap(m, n);
-		}
-
-		// Select Random Array Entry
-		int RandIndex = FMath::RandRange(0, (FilteredMontages.Num() - 1));
-		SelectedSyncedAttackAnimation = FilteredMontages[RandIndex];
-		Index = Montages.Find(SelectedSyncedAttackAnimation);
-		LastSyncedAttackAnimation = SelectedSyncedAttackAnimation;
-		return SelectedSyncedAttackAnimation;
-	}
-	else
-	{
-		SelectedSyncedAttackAnimation = FilteredMontages[0];
-		Index = Montages.Find(SelectedSyncedAttackAnimation);
-		LastSyncedAttackAnimation = SelectedSyncedAttackAnimation;
-		return SelectedSyncedAttackAnimation;
-	}
-	return SelectedSyncedAttackAnimation;
+	LastSyncedAttackAnimationIndex = Index;
+	return Settings->SyncedAttackAnimations[Index];
 }
 
 FAnticipationPose UALSXTCombatComponent::SelectBlockingkMontage_Implementation(const FGameplayTag& Strength, const FGameplayTag& Side, const FGameplayTag& Form, const FGameplayTag& Health)
@@ -875,27 +990,48 @@ FSyncedActionAnimation UALSXTCombatComponent::GetSyncedAttackMontage_Implementat
 	return Montages[Index].SyncedMontage;
 }
 
-void UALSXTCombatComponent::ServerStartAttack_Implementation(UAnimMontage* Montage, const float PlayRate,
+UAnimMontage* UALSXTCombatComponent::GetAttackMontageByIndex(const int32 Index)
+{
+	const auto* Settings{SelectAttackSettings()};
+
+	return IsValid(Settings) && Settings->AttackAnimations.IsValidIndex(Index)
+		       ? Settings->AttackAnimations[Index].Montage.Montage.Get()
+		       : nullptr;
+}
+
+UAnimMontage* UALSXTCombatComponent::GetSyncedAttackMontageByIndex(const int32 Index)
+{
+	const auto* Settings{SelectAttackSettings()};
+
+	return IsValid(Settings) && Settings->SyncedAttackAnimations.IsValidIndex(Index)
+		       ? Settings->SyncedAttackAnimations[Index].SyncedMontage.InstigatorSyncedMontage.Montage.Get()
+		       : nullptr;
+}
+
+void UALSXTCombatComponent::ServerStartAttack_Implementation(const int32 AttackAnimationIndex, const float PlayRate,
 	const float StartYawAngle, const float TargetYawAngle)
 {
-	if (IsAttackAllowedToStart(Montage))
+	const auto* Montage{GetAttackMontageByIndex(AttackAnimationIndex)};
+
+	if (IsValid(Montage) && IsAttackAllowedToStart(Montage))
 	{
-		MulticastStartAttack(Montage, PlayRate, StartYawAngle, TargetYawAngle);
+		MulticastStartAttack(AttackAnimationIndex, PlayRate, StartYawAngle, TargetYawAngle);
 		Character->ForceNetUpdate();
 	}
 }
 
-void UALSXTCombatComponent::MulticastStartAttack_Implementation(UAnimMontage* Montage, const float PlayRate,
+void UALSXTCombatComponent::MulticastStartAttack_Implementation(const int32 AttackAnimationIndex, const float PlayRate,
 	const float StartYawAngle, const float TargetYawAngle)
 {
-	StartAttackImplementation(Montage, PlayRate, StartYawAngle, TargetYawAngle);
+	StartAttackImplementation(AttackAnimationIndex, PlayRate, StartYawAngle, TargetYawAngle);
 }
 
-void UALSXTCombatComponent::StartAttackImplementation(UAnimMontage* Montage, const float PlayRate,
+void UALSXTCombatComponent::StartAttackImplementation(const int32 AttackAnimationIndex, const float PlayRate,
 	const float StartYawAngle, const float TargetYawAngle)
 {
-	
-	if (IsAttackAllowedToStart(Montage) && Character->GetMesh()->GetAnimInstance()->Montage_Play(Montage, PlayRate))
+	auto* Montage{GetAttackMontageByIndex(AttackAnimationIndex)};
+
+	if (IsValid(Montage) && IsAttackAllowedToStart(Montage) && Character->GetMesh()->GetAnimInstance()->Montage_Play(Montage, PlayRate))
 	{
 		CombatState.CombatParameters.TargetYawAngle = TargetYawAngle;
 
@@ -904,6 +1040,9 @@ void UALSXTCombatComponent::StartAttackImplementation(UAnimMontage* Montage, con
 		AlsCharacter->SetLocomotionAction(AlsLocomotionActionTags::PrimaryAction);
 		// Crouch(); //Hack
 
+		bAttackActive = true;
+		RefreshTickEnabled();
+
 		FALSXTCharacterVoiceParameters VoiceParameters = IALSXTCharacterSoundComponentInterface::Execute_GetVoiceParameters(GetOwner());
 
 		IALSXTCharacterSoundComponentInterface::Execute_PlayAttackSound(GetOwner(), true, true, true, VoiceParameters.Sex, VoiceParameters.Variant, Character->GetOverlayMode(), CombatParameters.Strength, CombatParameters.AttackType, IALSXTCharacterInterface::Execute_GetStamina(GetOwner()));
@@ -915,6 +1054,10 @@ void UALSXTCombatComponent::RefreshAttack(const float DeltaTime)
 	if (Character->GetLocomotionAction() != AlsLocomotionActionTags::PrimaryAction)
 	{
 		StopAttack();
+
+		bAttackActive = false;
+		RefreshTickEnabled();
+
 		Character->ForceNetUpdate();
 	}
 	else
@@ -968,26 +1111,30 @@ void UALSXTCombatComponent::StopAttack()
 
 void UALSXTCombatComponent::OnAttackEnded_Implementation() {}
 
-void UALSXTCombatComponent::ServerStartSyncedAttack_Implementation(UAnimMontage* Montage, int32 Index, const float PlayRate,
+void UALSXTCombatComponent::ServerStartSyncedAttack_Implementation(const int32 Index, const float PlayRate,
 	const float StartYawAngle, const float TargetYawAngle)
 {
-	if (IsAttackAllowedToStart(Montage))
+	const auto* Montage{GetSyncedAttackMontageByIndex(Index)};
+
+	if (IsValid(Montage) && IsAttackAllowedToStart(Montage))
 	{
-		MulticastStartSyncedAttack(Montage, Index, PlayRate, StartYawAngle, TargetYawAngle);
+		MulticastStartSyncedAttack(Index, PlayRate, StartYawAngle, TargetYawAngle);
 		Character->ForceNetUpdate();
 	}
 }
 
-void UALSXTCombatComponent::MulticastStartSyncedAttack_Implementation(UAnimMontage* Montage, int32 Index, const float PlayRate,
+void UALSXTCombatComponent::MulticastStartSyncedAttack_Implementation(const int32 Index, const float PlayRate,
 	const float StartYawAngle, const float TargetYawAngle)
 {
-	StartSyncedAttackImplementation(Montage, Index, PlayRate, StartYawAngle, TargetYawAngle);
+	StartSyncedAttackImplementation(Index, PlayRate, StartYawAngle, TargetYawAngle);
 }
 
-void UALSXTCombatComponent::StartSyncedAttackImplementation(UAnimMontage* Montage, int32 Index, const float PlayRate,
+void UALSXTCombatComponent::StartSyncedAttackImplementation(const int32 Index, const float PlayRate,
 	const float StartYawAngle, const float TargetYawAngle)
 {
-	if (IsAttackAllowedToStart(Montage) && Character->GetMesh()->GetAnimInstance()->Montage_Play(Montage, PlayRate))
+	auto* Montage{GetSyncedAttackMontageByIndex(Index)};
+
+	if (IsValid(Montage) && IsAttackAllowedToStart(Montage) && Character->GetMesh()->GetAnimInstance()->Montage_Play(Montage, PlayRate))
 	{
 		if (UKismetSystemLibrary::DoesImplementInterface(GetCombatState().CombatParameters.Target, UALSXTCombatInterface::StaticClass()))
 		{
@@ -1000,6 +1147,9 @@ void UALSXTCombatComponent::StartSyncedAttackImplementation(UAnimMontage* Montag
 		Character->ALSXTRefreshRotationInstant(StartYawAngle, ETeleportType::None);
 		AlsCharacter->SetLocomotionAction(AlsLocomotionActionTags::PrimaryAction);
 		// Crouch(); //Hack
+
+		bAttackActive = true;
+		RefreshTickEnabled();
 	}
 }
 
@@ -1008,6 +1158,10 @@ void UALSXTCombatComponent::RefreshSyncedAttack(const float DeltaTime)
 	if (Character->GetLocomotionAction() != AlsLocomotionActionTags::PrimaryAction)
 	{
 		StopAttack();
+
+		bAttackActive = false;
+		RefreshTickEnabled();
+
 		Character->ForceNetUpdate();
 	}
 	else
@@ -2,6 +2,8 @@
 
 
 #include "Components/Character/ALSXTEmoteComponent.h"
+#include "Utility/ALSXTNetAccounting.h"
+#include "Utility/ALSXTStats.h"
 
 // Sets default values for this component's properties
 UALSXTEmoteComponent::UALSXTEmoteComponent()
@@ -33,6 +35,14 @@ void UALSXTEmoteComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 	// ...
 }
 
+bool UALSXTEmoteComponent::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	ALSXTStats::RecordRpc(Function);
+	ALSXTNetAccounting::RecordRpc(*this, *Function, Parameters);
+
+	return Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+}
+
 // Emote
 
 void UALSXTEmoteComponent::AddDesiredEmote(const FGameplayTag& Emote)
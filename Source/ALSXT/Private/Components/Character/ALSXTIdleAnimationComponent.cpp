@@ -2,6 +2,7 @@
 
 #include "Components/Character/ALSXTIdleAnimationComponent.h"
 #include "Interfaces/ALSXTCharacterInterface.h"
+#include "Utility/ALSXTNetAccounting.h"
 
 // Sets default values for this component's properties
 UALSXTIdleAnimationComponent::UALSXTIdleAnimationComponent()
@@ -27,6 +28,13 @@ void UALSXTIdleAnimationComponent::GetLifetimeReplicatedProps(TArray<FLifetimePr
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, TargetTimeBetweenAnimations, Parameters)
 }
 
+void UALSXTIdleAnimationComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	ALSXTNetAccounting::RecordReplicatedProperties(*this);
+}
+
 
 // Called when the game starts
 void UALSXTIdleAnimationComponent::BeginPlay()
@@ -10,11 +10,16 @@
 #include "Kismet/GameplayStatics.h"
 #include "Math/RandomStream.h"
 #include "Utility/AlsMacros.h"
+#include "Utility/ALSXTGameplayTagEnumUtility.h"
 #include "InputActionValue.h"
 #include "Interfaces/ALSXTCharacterInterface.h"
 #include "Interfaces/ALSXTCombatInterface.h"
 #include "Interfaces/ALSXTCollisionInterface.h"
+#include "Subsystems/ALSXTLagCompensationSubsystem.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Utility/ALSXTNetAccounting.h"
+#include "Utility/ALSXTStats.h"
+#include "Utility/ALSXTInterfaceUtility.h"
 
 // Sets default values for this component's properties
 UALSXTImpactReactionComponent::UALSXTImpactReactionComponent()
@@ -40,6 +45,13 @@ void UALSXTImpactReactionComponent::GetLifetimeReplicatedProps(TArray<FLifetimeP
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ObstacleImpactHistory, Parameters)
 }
 
+void UALSXTImpactReactionComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	ALSXTNetAccounting::RecordReplicatedProperties(*this);
+}
+
 
 // Called when the game starts
 void UALSXTImpactReactionComponent::BeginPlay()
@@ -84,6 +96,14 @@ void UALSXTImpactReactionComponent::TickComponent(float DeltaTime, ELevelTick Ti
 	AnticipationTrace();
 }
 
+bool UALSXTImpactReactionComponent::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	ALSXTStats::RecordRpc(Function);
+	ALSXTNetAccounting::RecordRpc(*this, *Function, Parameters);
+
+	return Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+}
+
 void UALSXTImpactReactionComponent::OnCapsuleHit(UPrimitiveComponent* HitComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
 {
 	if ((OtherActor != NULL) && (OtherActor != Character) && (OtherComp != NULL))
@@ -119,9 +139,9 @@ bool UALSXTImpactReactionComponent::GetImpactFallLocation(FVector& Location, FDo
 	FVector ImpactVelocityVector = Hit.HitResult.Velocity;
 	FGameplayTag ImpactVelocityTag = Hit.Strength;
 	float ActorMass{ 0.0f };
-	IALSXTCollisionInterface::Execute_GetActorMass(Hit.HitResult.HitResult.GetActor(), ActorMass);
+	ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorMass, Hit.HitResult.HitResult.GetActor(), ActorMass);
 	FVector ActorVelocity{ FVector::ZeroVector };
-	IALSXTCollisionInterface::Execute_GetActorVelocity(Hit.HitResult.HitResult.GetActor(), ActorVelocity);
+	ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorVelocity, Hit.HitResult.HitResult.GetActor(), ActorVelocity);
 	FVector FallLocation = Character->GetActorLocation() * ImpactVelocityVector;
 
 	const auto* Capsule{ Character->GetCapsuleComponent() };
@@ -174,9 +194,9 @@ bool UALSXTImpactReactionComponent::GetAttackFallLocation(FVector& Location, FAt
 		FVector ImpactVelocityVector = Hit.DoubleHitResult.HitResult.Velocity;
 		FGameplayTag ImpactVelocityTag = Hit.DoubleHitResult.Strength;
 		float ActorMass{ 0.0f };
-		IALSXTCollisionInterface::Execute_GetActorMass(Hit.DoubleHitResult.HitResult.HitResult.GetActor(), ActorMass);
+		ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorMass, Hit.DoubleHitResult.HitResult.HitResult.GetActor(), ActorMass);
 		FVector ActorVelocity{ FVector::ZeroVector };
-		IALSXTCollisionInterface::Execute_GetActorVelocity(Hit.DoubleHitResult.HitResult.HitResult.GetActor(), ActorVelocity);
+		ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorVelocity, Hit.DoubleHitResult.HitResult.HitResult.GetActor(), ActorVelocity);
 		FVector FallLocation = Character->GetActorLocation() * ImpactVelocityVector;
 		const auto* Capsule{ Character->GetCapsuleComponent() };
 		const auto CapsuleScale{ Capsule->GetComponentScale().Z };
@@ -906,17 +926,15 @@ FGameplayTag UALSXTImpactReactionComponent::GetCharacterVelocity()
 	}
 	else
 	{
-		FGameplayTag CharacterGait = Character->GetDesiredGait();
-		if (CharacterGait == AlsGaitTags::Walking)
+		switch (ALSXTGameplayTagEnumUtility::ToEnum<EALSXTGait>(Character->GetDesiredGait()))
 		{
+		case EALSXTGait::Walking:
 			return ALSXTImpactVelocityTags::Slow;
-		}
-		else if (CharacterGait == AlsGaitTags::Walking)
-		{
+
+		case EALSXTGait::Running:
 			return ALSXTImpactVelocityTags::Moderate;
-		}
-		else
-		{
+
+		default:
 			return ALSXTImpactVelocityTags::Fast;
 		}
 	}
@@ -979,6 +997,8 @@ bool UALSXTImpactReactionComponent::ValidateNewHit(AActor* ActorToCheck)
 
 void UALSXTImpactReactionComponent::ObstacleTrace()
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_ObstacleTrace, GetOwner());
+
 	const auto* Capsule{ Character->GetCapsuleComponent() };
 	const auto CapsuleScale{ Capsule->GetComponentScale().Z };
 	auto CapsuleRadius{ ImpactReactionSettings.BumpDetectionRadius };
@@ -1010,6 +1030,7 @@ void UALSXTImpactReactionComponent::ObstacleTrace()
 		}
 		const FVector EndLocation{ StartLocation + (Character->GetVelocity() * TraceDistance) };
 
+		ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
 		if (UKismetSystemLibrary::CapsuleTraceMultiForObjects(GetWorld(), StartLocation, EndLocation, CapsuleRadius, CapsuleHalfHeight / 2, ImpactReactionSettings.BumpTraceObjectTypes, false, IgnoreActors, BumpDebugMode, HitResults, true, FLinearColor::Green, FLinearColor::Red, 5.0f))
 		{
 			for (FHitResult HitResult : HitResults)
@@ -1020,6 +1041,7 @@ void UALSXTImpactReactionComponent::ObstacleTrace()
 
 				if (ValidateNewHit(HitResult.GetActor()))
 				{
+					ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
 					if (HitResult.GetComponent()->GetOwner() != GetOwner() && UKismetSystemLibrary::CapsuleTraceSingleForObjects(GetWorld(), HitResult.ImpactPoint, StartLocation, CapsuleRadius, CapsuleHalfHeight / 2, ImpactReactionSettings.BumpTraceObjectTypes, false, IgnoreActorsOrigin, EDrawDebugTrace::None, OriginHitResult, false, FLinearColor::Green, FLinearColor::Red, 5.0f))
 					{
 						FALSXTImpactReactionState NewImpactReactionState;
@@ -1031,8 +1053,8 @@ void UALSXTImpactReactionComponent::ObstacleTrace()
 
 						if (UKismetSystemLibrary::DoesImplementInterface(HitResult.GetActor(), UALSXTCollisionInterface::StaticClass()))
 						{
-							IALSXTCollisionInterface::Execute_GetActorMass(HitResult.GetActor(), DoubleHitResult.HitResult.Mass);
-							IALSXTCollisionInterface::Execute_GetActorVelocity(HitResult.GetActor(), DoubleHitResult.HitResult.Velocity);
+							ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorMass, HitResult.GetActor(), DoubleHitResult.HitResult.Mass);
+							ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorVelocity, HitResult.GetActor(), DoubleHitResult.HitResult.Velocity);
 						}
 						else
 						{
@@ -1048,11 +1070,11 @@ void UALSXTImpactReactionComponent::ObstacleTrace()
 						FGameplayTag FormTag = ConvertPhysicalSurfaceToFormTag(OriginPhysSurf);
 						DoubleHitResult.ImpactForm = FormTag;
 						DoubleHitResult.ImpactSide = SideTag;
-						IALSXTCollisionInterface::Execute_GetActorMass(Character, DoubleHitResult.OriginHitResult.Mass);
-						IALSXTCollisionInterface::Execute_GetActorVelocity(Character, DoubleHitResult.OriginHitResult.Velocity);
+						ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorMass, Character, DoubleHitResult.OriginHitResult.Mass);
+						ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorVelocity, Character, DoubleHitResult.OriginHitResult.Velocity);
 						// NewImpactReactionState.ImpactReactionParameters = ImpactReactionParameters;
 
-						if (UKismetSystemLibrary::DoesImplementInterface(HitResult.GetActor(), UALSXTCharacterInterface::StaticClass()) && IALSXTCharacterInterface::Execute_GetCombatStance(HitResult.GetActor()) == ALSXTCombatStanceTags::Neutral)
+						if (UKismetSystemLibrary::DoesImplementInterface(HitResult.GetActor(), UALSXTCharacterInterface::StaticClass()) && ALSXT_EXECUTE_NATIVE(IALSXTCharacterInterface, GetCombatStance, HitResult.GetActor()) == ALSXTCombatStanceTags::Neutral)
 						{
 							if (Character->GetVelocity().Length() < FGenericPlatformMath::Min(ImpactReactionSettings.CharacterBumpDetectionMinimumVelocity, ImpactReactionSettings.ObstacleBumpDetectionMinimumVelocity))
 							{
@@ -1121,6 +1143,8 @@ void UALSXTImpactReactionComponent::ObstacleTrace()
 
 void UALSXTImpactReactionComponent::AnticipationTrace()
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_AnticipationTrace, GetOwner());
+
 	const auto* Capsule{ Character->GetCapsuleComponent() };
 	const auto CapsuleScale{ Capsule->GetComponentScale().Z };
 	auto CapsuleRadius{ ImpactReactionSettings.BumpDetectionRadius };
@@ -1138,6 +1162,7 @@ void UALSXTImpactReactionComponent::AnticipationTrace()
 
 	if (Character->GetDefensiveModeState().Mode != ALSXTDefensiveModeTags::ClutchImpactPoint)
 	{
+		ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
 		bool isHit = UKismetSystemLibrary::BoxTraceMultiForObjects(GetWorld(), StartLocation, EndLocation, ImpactReactionSettings.AnticipationAreaHalfSize, Character->GetControlRotation(), ImpactReactionSettings.BumpTraceObjectTypes, false, IgnoreActors, EDrawDebugTrace::None, HitResults, true, FLinearColor::Green, FLinearColor::Red, 5.0f);
 		if (isHit)
 		{
@@ -1152,9 +1177,9 @@ void UALSXTImpactReactionComponent::AnticipationTrace()
 					FVector AnticipationPoint{ FVector::ZeroVector };
 					FALSXTDefensiveModeState DefensiveModeState;
 					FAnticipationPose Montage;
-					FGameplayTag CharacterCombatStance = IALSXTCharacterInterface::Execute_GetCombatStance(HitResult.GetActor());
-					IALSXTCollisionInterface::Execute_GetActorMass(HitResult.GetActor(), ActorMass);
-					IALSXTCollisionInterface::Execute_GetActorVelocity(HitResult.GetActor(), ActorVelocity);
+					FGameplayTag CharacterCombatStance = ALSXT_EXECUTE_NATIVE(IALSXTCharacterInterface, GetCombatStance, HitResult.GetActor());
+					ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorMass, HitResult.GetActor(), ActorMass);
+					ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorVelocity, HitResult.GetActor(), ActorVelocity);
 					IALSXTCollisionInterface::Execute_GetAnticipationInfo(HitResult.GetActor(), Velocity, Form, AnticipationPoint);
 
 					FGameplayTag DefensiveMode = IALSXTCombatInterface::Execute_Attacking(HitResult.GetActor()) ? DetermineDefensiveModeFromAttackingCharacter(Form, CharacterCombatStance) : DetermineDefensiveModeFromCharacter(Form, CharacterCombatStance);
@@ -1194,8 +1219,8 @@ void UALSXTImpactReactionComponent::AnticipationTrace()
 						FVector AnticipationPoint{ FVector::ZeroVector };
 						FALSXTDefensiveModeState DefensiveModeState = Character->GetDefensiveModeState();
 						FAnticipationPose Montage;
-						IALSXTCollisionInterface::Execute_GetActorMass(HitResult.GetActor(), ActorMass);
-						IALSXTCollisionInterface::Execute_GetActorVelocity(HitResult.GetActor(), ActorVelocity);
+						ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorMass, HitResult.GetActor(), ActorMass);
+						ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorVelocity, HitResult.GetActor(), ActorVelocity);
 						IALSXTCollisionInterface::Execute_GetAnticipationInfo(HitResult.GetActor(), Velocity, Form, AnticipationPoint);
 						FGameplayTag DefensiveMode = DetermineDefensiveMode(Form);
 						FGameplayTag Stance = Character->GetDesiredStance();
@@ -1412,14 +1437,39 @@ void UALSXTImpactReactionComponent::ImpactReaction(FDoubleHitResult Hit)
 
 void UALSXTImpactReactionComponent::AttackReaction(FAttackDoubleHitResult Hit)
 {
-	if (Character->GetLocalRole() == ROLE_AutonomousProxy)
+	// The server starts the reaction once the attacker reports the hit, see ReceiveAttackHit().
+
+	if (Character->GetLocalRole() == ROLE_SimulatedProxy && Character->GetRemoteRole() == ROLE_Authority)
 	{
-		ServerAttackReaction(Hit);
+		StartAttackReaction(Hit);
 	}
-	else if (Character->GetLocalRole() == ROLE_SimulatedProxy && Character->GetRemoteRole() == ROLE_Authority)
+}
+
+void UALSXTImpactReactionComponent::ReceiveAttackHit(const ACharacter& Attacker, const FAttackDoubleHitResult& Hit)
+{
+	auto* LagCompensation{GetWorld()->GetSubsystem<UALSXTLagCompensationSubsystem>()};
+
+	if (Attacker.GetRemoteRole() != ROLE_AutonomousProxy || !IsValid(LagCompensation))
 	{
 		StartAttackReaction(Hit);
+		Character->ForceNetUpdate();
+		return;
 	}
+
+	// Check the hit against where this character was for the attacker at the time of the hit, rather than where it
+	// is now. The time sent by the attacker's client is only trusted within the round trip time of its connection.
+
+	const auto HitTime{LagCompensation->GetRewindTime(Attacker, Hit.TimeStamp)};
+
+	LagCompensation->RequestHitValidation(Character, Hit.DoubleHitResult.HitResult.HitResult.ImpactPoint, HitTime,
+	                                      [WeakThis = TWeakObjectPtr<ThisClass>{this}, Hit](const bool bValid)
+	                                      {
+		                                      if (bValid && WeakThis.IsValid() && IsValid(WeakThis->Character))
+		                                      {
+			                                      WeakThis->StartAttackReaction(Hit);
+			                                      WeakThis->Character->ForceNetUpdate();
+		                                      }
+	                                      });
 }
 
 void UALSXTImpactReactionComponent::SyncedAttackReaction(int Index)
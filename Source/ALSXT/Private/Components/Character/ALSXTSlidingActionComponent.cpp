@@ -7,6 +7,8 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Settings/ALSXTCharacterSettings.h"
 #include "Utility/AlsMacros.h"
+#include "Utility/ALSXTNetAccounting.h"
+#include "Utility/ALSXTStats.h"
 
 // Sets default values for this component's properties
 UALSXTSlidingActionComponent::UALSXTSlidingActionComponent()
@@ -47,6 +49,14 @@ void UALSXTSlidingActionComponent::TickComponent(float DeltaTime, ELevelTick Tic
 	// Character->GetCharacterMovement()->CurrentFloor.HitResult.ImpactNormal.ZAxisVector;
 }
 
+bool UALSXTSlidingActionComponent::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	ALSXTStats::RecordRpc(Function);
+	ALSXTNetAccounting::RecordRpc(*this, *Function, Parameters);
+
+	return Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+}
+
 void UALSXTSlidingActionComponent::TryStartSliding(const float PlayRate)
 {
 	if (Character->GetLocomotionMode() == AlsLocomotionModeTags::Grounded)
@@ -4,8 +4,11 @@
 #include "Components/Mesh/ALSXTPaintableSkeletalMeshComponent.h"
 #include "Interfaces/ALSXTMeshPaintingInterface.h"
 #include "Settings/ALSXTCharacterSettings.h"
+#include "Utility/ALSXTGameplayTagEnumUtility.h"
+#include "Utility/ALSXTStats.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/KismetRenderingLibrary.h"
+#include "Utility/ALSXTInterfaceUtility.h"
 
 UALSXTPaintableSkeletalMeshComponent::UALSXTPaintableSkeletalMeshComponent()
 {
@@ -18,8 +21,8 @@ void UALSXTPaintableSkeletalMeshComponent::BeginPlay()
 
 	if (IsMeshPaintingConfigured())
 	{
-		SceneCaptureComponent = IALSXTMeshPaintingInterface::Execute_GetSceneCaptureComponent(GetOwner());
-		GlobalGeneralMeshPaintingSettings = IALSXTMeshPaintingInterface::Execute_GetGlobalGeneralMeshPaintingSettings(GetOwner());
+		SceneCaptureComponent = ALSXT_EXECUTE(IALSXTMeshPaintingInterface, GetSceneCaptureComponent, GetOwner());
+		GlobalGeneralMeshPaintingSettings = ALSXT_EXECUTE(IALSXTMeshPaintingInterface, GetGlobalGeneralMeshPaintingSettings, GetOwner());
 		if (IsMeshPaintingEnabled())
 		{
 			// InitializeMaterials();
@@ -56,7 +59,7 @@ bool UALSXTPaintableSkeletalMeshComponent::IsMeshPaintingConfigured() const
 	{
 		return false;
 	}
-	if (!IALSXTMeshPaintingInterface::Execute_GetSceneCaptureComponent(GetOwner()))
+	if (!ALSXT_EXECUTE(IALSXTMeshPaintingInterface, GetSceneCaptureComponent, GetOwner()))
 	{
 		return false;
 	}
@@ -248,6 +251,7 @@ TEnumAsByte<EPhysicalSurface> UALSXTPaintableSkeletalMeshComponent::GetSurfaceAt
 	// IgnoredActors.Add(Character);	// Add Self to Initial Trace Ignored Actors
 	TArray<TEnumAsByte<EObjectTypeQuery>> TraceObjectTypes;
 	// TraceObjectTypes = ;
+	ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
 	bool isHit = UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), Location, Location, 2, TraceObjectTypes, false, IgnoredActors, EDrawDebugTrace::None, OutHits, true, FLinearColor::Green, FLinearColor::Red, 0.0f);
 
 	if (isHit)
@@ -268,34 +272,18 @@ TEnumAsByte<EPhysicalSurface> UALSXTPaintableSkeletalMeshComponent::GetSurfaceAt
 // Check if a Paint Type is Enabled Globally (ALSXT Character Settings), on Server (Delegate Implementable), and in User Preferences (Delegate Implementable). Global, Server and User must be True to return True. Default: All True
 bool UALSXTPaintableSkeletalMeshComponent::CanBePainted(const FGameplayTag PaintType)
 {
-	// Ideally, User Settings should only apply for Single Player/Offline Play. The Server Browser/Match Making should not allow for Users with a setting disabled to connect to a Server with the same setting Enabled
-	FALSXTServerMeshPaintingSettings ServerGeneralMeshPaintingSettings{ IALSXTMeshPaintingInterface::Execute_GetServerGeneralMeshPaintingSettings(GetOwner()) };
-	FALSXTGeneralMeshPaintingSettings UserGeneralMeshPaintingSettings{ IALSXTMeshPaintingInterface::Execute_GetUserGeneralMeshPaintingSettings(GetOwner()) };
+	const auto PaintTypeValue{ALSXTGameplayTagEnumUtility::ToEnum<EALSXTMeshPaintType>(PaintType)};
 
-	if (PaintType == ALSXTMeshPaintTypeTags::BloodDamage)
-	{
-		return GlobalGeneralMeshPaintingSettings.GeneralSettings.bEnableMeshPainting && ServerGeneralMeshPaintingSettings.GeneralSettings.bEnableMeshPainting && UserGeneralMeshPaintingSettings.bEnableMeshPainting && GlobalGeneralMeshPaintingSettings.GeneralSettings.bEnableBloodDamage && ServerGeneralMeshPaintingSettings.GeneralSettings.bEnableBloodDamage && UserGeneralMeshPaintingSettings.bEnableBloodDamage;
-	}
-	if (PaintType == ALSXTMeshPaintTypeTags::BackSpatter)
-	{
-		return GlobalGeneralMeshPaintingSettings.GeneralSettings.bEnableMeshPainting && ServerGeneralMeshPaintingSettings.GeneralSettings.bEnableMeshPainting && UserGeneralMeshPaintingSettings.bEnableMeshPainting && GlobalGeneralMeshPaintingSettings.GeneralSettings.bEnableBackspatter && ServerGeneralMeshPaintingSettings.GeneralSettings.bEnableBackspatter && UserGeneralMeshPaintingSettings.bEnableBackspatter;
-	}
-	if (PaintType == ALSXTMeshPaintTypeTags::Burn)
-	{
-		return GlobalGeneralMeshPaintingSettings.GeneralSettings.bEnableMeshPainting && ServerGeneralMeshPaintingSettings.GeneralSettings.bEnableMeshPainting && UserGeneralMeshPaintingSettings.bEnableMeshPainting && GlobalGeneralMeshPaintingSettings.GeneralSettings.bEnableBurnDamage && ServerGeneralMeshPaintingSettings.GeneralSettings.bEnableBurnDamage && UserGeneralMeshPaintingSettings.bEnableBurnDamage;
-	}
-	if (PaintType == ALSXTMeshPaintTypeTags::SurfaceDamage)
-	{
-		return GlobalGeneralMeshPaintingSettings.GeneralSettings.bEnableMeshPainting && ServerGeneralMeshPaintingSettings.GeneralSettings.bEnableMeshPainting && UserGeneralMeshPaintingSettings.bEnableMeshPainting && GlobalGeneralMeshPaintingSettings.GeneralSettings.bEnableSurfaceDamage && ServerGeneralMeshPaintingSettings.GeneralSettings.bEnableSurfaceDamage && UserGeneralMeshPaintingSettings.bEnableSurfaceDamage;
-	}
-	if (PaintType == ALSXTMeshPaintTypeTags::Saturation)
-	{
-		return GlobalGeneralMeshPaintingSettings.GeneralSettings.bEnableMeshPainting && ServerGeneralMeshPaintingSettings.GeneralSettings.bEnableMeshPainting && UserGeneralMeshPaintingSettings.bEnableMeshPainting && GlobalGeneralMeshPaintingSettings.GeneralSettings.bEnableSaturation && ServerGeneralMeshPaintingSettings.GeneralSettings.bEnableSaturation && UserGeneralMeshPaintingSettings.bEnableSaturation;
-	}
-	else
+	if (!GlobalGeneralMeshPaintingSettings.GeneralSettings.IsPaintTypeEnabled(PaintTypeValue))
 	{
 		return false;
 	}
+
+	// Ideally, User Settings should only apply for Single Player/Offline Play. The Server Browser/Match Making should not allow for Users with a setting disabled to connect to a Server with the same setting Enabled
+	FALSXTServerMeshPaintingSettings ServerGeneralMeshPaintingSettings{ IALSXTMeshPaintingInterface::Execute_GetServerGeneralMeshPaintingSettings(GetOwner()) };
+	FALSXTGeneralMeshPaintingSettings UserGeneralMeshPaintingSettings{ IALSXTMeshPaintingInterface::Execute_GetUserGeneralMeshPaintingSettings(GetOwner()) };
+
+	return ServerGeneralMeshPaintingSettings.GeneralSettings.IsPaintTypeEnabled(PaintTypeValue) && UserGeneralMeshPaintingSettings.IsPaintTypeEnabled(PaintTypeValue);
 }
 
 // Check if a Surface Type can be painted by Paint Type of Element Surface Type. Performs a search for the provided Surface in the current Criteria Map, and Item Mesh Criteria (if it is set)
@@ -332,50 +320,57 @@ bool UALSXTPaintableSkeletalMeshComponent::ShouldBePainted(TEnumAsByte<EPhysical
 
 void UALSXTPaintableSkeletalMeshComponent::GetMaterialsForPaintType(const FGameplayTag PaintType, UMaterialInstanceDynamic*& MaterialInstance, UMaterialInstanceDynamic*& FadeMaterialInstance, UTextureRenderTarget2D*& RenderTarget, UTextureRenderTarget2D*& FadeRenderTarget, FName& ParamName)
 {
-	if (PaintType == ALSXTMeshPaintTypeTags::BloodDamage)
+	switch (ALSXTGameplayTagEnumUtility::ToEnum<EALSXTMeshPaintType>(PaintType))
 	{
+	case EALSXTMeshPaintType::BloodDamage:
 		MaterialInstance = MIDBloodDamage;
 		FadeMaterialInstance = MIDBloodDamageFade;
 		RenderTarget = BloodDamageRenderTarget;
 		FadeRenderTarget = BloodDamageFadeRenderTarget;
 		ParamName = "BloodDamage";
-	}
-	if (PaintType == ALSXTMeshPaintTypeTags::SurfaceDamage)
-	{
+		break;
+
+	case EALSXTMeshPaintType::SurfaceDamage:
 		MaterialInstance = MIDSurfaceDamage;
 		FadeMaterialInstance = MIDSurfaceDamageFade;
 		RenderTarget = SurfaceDamageRenderTarget;
 		FadeRenderTarget = SurfaceDamageFadeRenderTarget;
 		ParamName = "SurfaceDamage";
-	}
-	if (PaintType == ALSXTMeshPaintTypeTags::BackSpatter)
-	{
+		break;
+
+	case EALSXTMeshPaintType::BackSpatter:
 		MaterialInstance = MIDBackSpatter;
 		FadeMaterialInstance = MIDBackSpatterFade;
 		RenderTarget = BackSpatterRenderTarget;
 		FadeRenderTarget = BackSpatterFadeRenderTarget;
 		ParamName = "BackSpatter";
-	}
-	if (PaintType == ALSXTMeshPaintTypeTags::Saturation)
-	{
+		break;
+
+	case EALSXTMeshPaintType::Saturation:
 		MaterialInstance = MIDSaturation;
 		FadeMaterialInstance = MIDSaturationFade;
 		RenderTarget = SaturationRenderTarget;
 		FadeRenderTarget = SaturationFadeRenderTarget;
 		ParamName = "Saturation";
-	}
-	if (PaintType == ALSXTMeshPaintTypeTags::Burn)
-	{
+		break;
+
+	case EALSXTMeshPaintType::Burn:
 		MaterialInstance = MIDBurn;
 		FadeMaterialInstance = MIDBurnFade;
 		RenderTarget = BurnRenderTarget;
 		FadeRenderTarget = BurnFadeRenderTarget;
 		ParamName = "Burn";
+		break;
+
+	default:
+		break;
 	}
 }
 
 void UALSXTPaintableSkeletalMeshComponent::PaintMesh(TEnumAsByte<EPhysicalSurface> SurfaceType, const FGameplayTag PaintType, FVector Location, float Radius)
 {
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_MeshPainting, GetOwner());
+
 	if (CanBePainted(PaintType))
 	{
 		TEnumAsByte<EPhysicalSurface> FoundSurfaceType = GetSurfaceAtLocation(Location);
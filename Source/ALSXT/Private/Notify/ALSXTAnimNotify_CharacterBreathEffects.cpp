@@ -7,7 +7,10 @@
 #include "ALSXTAnimationInstance.h"
 #include "ALSXTCharacter.h"
 #include "Interfaces/ALSXTCharacterInterface.h"
-#include "NiagaraFunctionLibrary.h"
+#include "Subsystems/ALSXTEffectCommandSubsystem.h"
+#include "Subsystems/ALSXTEffectSpawnSubsystem.h"
+#include "Utility/ALSXTStats.h"
+#include "Utility/ALSXTInterfaceUtility.h"
 
 // ReSharper disable once CppUnusedIncludeDirective
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTAnimNotify_CharacterBreathEffects)
@@ -21,10 +24,32 @@ void UALSXTAnimNotify_CharacterBreathEffects::Notify(USkeletalMeshComponent* Mes
 	const FAnimNotifyEventReference& EventReference)
 {
 	Super::Notify(Mesh, Animation, EventReference);
+
+	if (!IsValid(Mesh))
+	{
+		return;
+	}
+
+	auto* EffectCommandSubsystem{Mesh->GetWorld()->GetSubsystem<UALSXTEffectCommandSubsystem>()};
+	if (IsValid(EffectCommandSubsystem))
+	{
+		EffectCommandSubsystem->RecordCommand(EALSXTEffectCommandType::CharacterBreath, 0, this, Mesh);
+	}
+	else
+	{
+		SpawnEffects(Mesh);
+	}
+}
+
+void UALSXTAnimNotify_CharacterBreathEffects::SpawnEffects(USkeletalMeshComponent* Mesh)
+{
 	if (!IsValid(Mesh))
 	{
 		return;
 	}
+
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_EffectNotify, Mesh->GetOwner());
+
 	if (!EnableCharacterBreathEffects)
 	{
 		return;
@@ -32,7 +57,7 @@ void UALSXTAnimNotify_CharacterBreathEffects::Notify(USkeletalMeshComponent* Mes
 	const auto* World{ Mesh->GetWorld() };
 	if (World->WorldType != EWorldType::EditorPreview)
 	{
-		FGameplayTag Status{ IALSXTCharacterInterface::Execute_GetStatus(Mesh->GetOwner()) };
+		FGameplayTag Status{ ALSXT_EXECUTE_NATIVE(IALSXTCharacterInterface, GetStatus, Mesh->GetOwner()) };
 		if (Status == ALSXTStatusTags::Dead)
 		{
 			return;
@@ -47,7 +72,11 @@ void UALSXTAnimNotify_CharacterBreathEffects::Notify(USkeletalMeshComponent* Mes
 		}
 		if (PreviewParticle)
 		{
-			UNiagaraFunctionLibrary::SpawnSystemAttached(PreviewParticle, Mesh, "head", Mesh->GetSocketLocation("head"), Mesh->GetSocketRotation("head"), EAttachLocation::KeepWorldPosition, true, true, ENCPoolMethod::None, true);
+			auto* EffectSpawnSubsystem{World->GetSubsystem<UALSXTEffectSpawnSubsystem>()};
+			if (IsValid(EffectSpawnSubsystem))
+			{
+				EffectSpawnSubsystem->SpawnSystemAttached(EALSXTEffectSpawnType::Breath, PreviewParticle, Mesh, "head", Mesh->GetSocketLocation("head"), Mesh->GetSocketRotation("head"), FVector::OneVector, EAttachLocation::KeepWorldPosition);
+			}
 		}
 	}
 }
\ No newline at end of file
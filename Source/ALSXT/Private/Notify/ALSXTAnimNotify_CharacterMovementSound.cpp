@@ -6,6 +6,8 @@
 #include "ALSXTAnimationInstance.h"
 #include "ALSXTCharacter.h"
 #include "Interfaces/ALSXTCharacterInterface.h"
+#include "Subsystems/ALSXTEffectCommandSubsystem.h"
+#include "Utility/ALSXTStats.h"
 
 // ReSharper disable once CppUnusedIncludeDirective
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTAnimNotify_CharacterMovementSound)
@@ -26,6 +28,26 @@ void UALSXTAnimNotify_CharacterMovementSound::Notify(USkeletalMeshComponent* Mes
 		return;
 	}
 
+	auto* EffectCommandSubsystem{Mesh->GetWorld()->GetSubsystem<UALSXTEffectCommandSubsystem>()};
+	if (IsValid(EffectCommandSubsystem))
+	{
+		EffectCommandSubsystem->RecordCommand(EALSXTEffectCommandType::CharacterMovementSound, 0, this, Mesh);
+	}
+	else
+	{
+		SpawnEffects(Mesh);
+	}
+}
+
+void UALSXTAnimNotify_CharacterMovementSound::SpawnEffects(USkeletalMeshComponent* Mesh)
+{
+	if (!IsValid(Mesh))
+	{
+		return;
+	}
+
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_EffectNotify, Mesh->GetOwner());
+
 	const auto* World{ Mesh->GetWorld() };
 	const auto* Character{ Cast<AAlsCharacter>(Mesh->GetOwner()) };
 	AALSXTCharacter* ALSXTCharacter{ Cast<AALSXTCharacter>(Mesh->GetOwner()) };
@@ -3,13 +3,13 @@
 #include "AlsCharacter.h"
 #include "ALSXTAnimationInstance.h"
 #include "ALSXTCharacter.h"
-#include "DrawDebugHelpers.h"
 #include "NiagaraComponent.h"
-#include "NiagaraFunctionLibrary.h"
 #include "Animation/AnimInstance.h"
 #include "Components/AudioComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/DecalComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
 #include "Kismet/GameplayStatics.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "Utility/AlsConstants.h"
@@ -17,9 +17,179 @@
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMath.h"
 #include "Utility/AlsUtility.h"
+#include "Utility/ALSXTGameplayTagEnumUtility.h"
 #include "State/ALSXTFootstepState.h"
+#include "Subsystems/ALSXTEffectCommandSubsystem.h"
+#include "Subsystems/ALSXTEffectSpawnSubsystem.h"
+#include "Subsystems/ALSXTFootstepEffectsSubsystem.h"
 #include "Engine/GameEngine.h"
 #include "Math/UnrealMathUtility.h"
+#include "Utility/ALSXTStats.h"
+
+namespace ALSXTFootstepEffects
+{
+	// Parameter names are resolved once rather than on every footstep.
+	struct FFootprintDecalParameterNames
+	{
+		const FName SoleTexture{TEXT("SoleTexture")};
+		const FName SoleNormal{TEXT("SoleNormal")};
+		const FName SoleDetail{TEXT("SoleDetail")};
+		const FName SoleNormalScale{TEXT("SoleNormalScale")};
+		const FName Opacity{TEXT("Opacity")};
+		const FName PhaseAlpha{TEXT("PhaseAlpha")};
+
+		const FName TransferDetailTexture{TEXT("TransferDetailTexture")};
+		const FName TransferDetailNormal{TEXT("TransferDetailNormal")};
+		const FName TransferNormalScale{TEXT("TransferNormalScale")};
+		const FName TransferDetailScale{TEXT("TransferDetailScale")};
+		const FName PrimaryColor{TEXT("PrimaryColor")};
+		const FName SecondaryColor{TEXT("SecondaryColor")};
+		const FName GrainSize{TEXT("GrainSize")};
+		const FName Wetness{TEXT("Wetness")};
+		const FName EmissiveAmount{TEXT("EmissiveAmount")};
+		const FName TransferAmount{TEXT("TransferAmount")};
+		const FName SurfaceTransferAmount{TEXT("SurfaceTransferAmount")};
+
+		const FName TransferDetailTexturePrevious{TEXT("TransferDetailTexturePrevious")};
+		const FName TransferDetailNormalPrevious{TEXT("TransferDetailNormalPrevious")};
+		const FName TransferNormalScalePrevious{TEXT("TransferNormalScalePrevious")};
+		const FName TransferDetailScalePrevious{TEXT("TransferDetailScalePrevious")};
+		const FName PrimaryColorPrevious{TEXT("PrimaryColorPrevious")};
+		const FName SecondaryColorPrevious{TEXT("SecondaryColorPrevious")};
+		const FName GrainSizePrevious{TEXT("GrainSizePrevious")};
+		const FName WetnessPrevious{TEXT("WetnessPrevious")};
+		const FName EmissiveAmountPrevious{TEXT("EmissiveAmountPrevious")};
+		const FName TransferAmountPrevious{TEXT("TransferAmountPrevious")};
+		const FName SurfaceTransferAmountPrevious{TEXT("SurfaceTransferAmountPrevious")};
+	};
+
+	const FFootprintDecalParameterNames& GetFootprintDecalParameterNames()
+	{
+		static const FFootprintDecalParameterNames Names;
+		return Names;
+	}
+
+	void SetFootprintDecalParameters(UMaterialInstanceDynamic& Material, const EALSXTFootBone FootBone, const FALSXTFootwearDetails& Footwear,
+	                                 const FALSXTFootprintState& Footprint, const FALSXTFootstepEffectSettings& EffectSettings)
+	{
+		const auto& Names{GetFootprintDecalParameterNames()};
+		const auto& Current{Footprint.Current};
+		const auto& Previous{Footprint.Previous};
+		const auto Acceptance{EffectSettings.SurfaceTransferAcceptanceAmount};
+
+		Material.SetTextureParameterValue(Names.SoleTexture, Footwear.FootwearSoleTexture);
+		Material.SetTextureParameterValue(Names.SoleNormal, Footwear.FootwearSoleNormalTexture);
+		Material.SetTextureParameterValue(Names.SoleDetail, Footwear.FootwearSoleDetailTexture);
+		Material.SetScalarParameterValue(Names.SoleNormalScale,
+		                                 (EffectSettings.TransferNormalScale + EffectSettings.SurfaceTransferAcceptanceNormalScale) *
+		                                 EffectSettings.SurfaceTransferAmount * Acceptance);
+		Material.SetScalarParameterValue(Names.Opacity, Acceptance);
+		Material.SetScalarParameterValue(Names.PhaseAlpha, Footprint.FootSurfaceAlpha);
+
+		Material.SetTextureParameterValue(Names.TransferDetailTexture, Current.TransferDetailTexture);
+		Material.SetTextureParameterValue(Names.TransferDetailNormal, Current.TransferDetailNormal);
+		Material.SetScalarParameterValue(Names.TransferNormalScale, Current.TransferNormalScale * Acceptance);
+		Material.SetScalarParameterValue(Names.TransferDetailScale, Current.TransferDetailScale);
+		Material.SetVectorParameterValue(Names.PrimaryColor, Current.TransferPrimaryColor);
+		Material.SetVectorParameterValue(Names.SecondaryColor, Current.TransferSecondaryColor);
+		Material.SetScalarParameterValue(Names.GrainSize, Current.TransferGrainSize);
+		Material.SetScalarParameterValue(Names.Wetness, Current.TransferWetness * Acceptance);
+		Material.SetScalarParameterValue(Names.EmissiveAmount, Current.TransferEmissiveAmount * Acceptance);
+		Material.SetScalarParameterValue(Names.TransferAmount, Current.TransferAmount * Acceptance);
+		Material.SetScalarParameterValue(Names.SurfaceTransferAmount, Current.SurfaceTransferAmount * Acceptance);
+
+		Material.SetTextureParameterValue(Names.TransferDetailTexturePrevious, Previous.TransferDetailTexture);
+		Material.SetTextureParameterValue(Names.TransferDetailNormalPrevious, Previous.TransferDetailNormal);
+
+		// The right foot has always used the unscaled previous normal scale, keep it that way.
+
+		Material.SetScalarParameterValue(Names.TransferNormalScalePrevious, FootBone == EALSXTFootBone::Left
+			                                                                    ? Previous.TransferNormalScale * Acceptance
+			                                                                    : Previous.TransferNormalScale);
+		Material.SetScalarParameterValue(Names.TransferDetailScalePrevious, Previous.TransferDetailScale);
+		Material.SetVectorParameterValue(Names.PrimaryColorPrevious, Previous.TransferPrimaryColor);
+		Material.SetVectorParameterValue(Names.SecondaryColorPrevious, Previous.TransferSecondaryColor);
+		Material.SetScalarParameterValue(Names.GrainSizePrevious, Previous.TransferGrainSize);
+		Material.SetScalarParameterValue(Names.WetnessPrevious, Previous.TransferWetness * Acceptance);
+		Material.SetScalarParameterValue(Names.EmissiveAmountPrevious, Previous.TransferEmissiveAmount * Acceptance);
+		Material.SetScalarParameterValue(Names.TransferAmountPrevious, Previous.TransferAmount * Acceptance);
+		Material.SetScalarParameterValue(Names.SurfaceTransferAmountPrevious, Previous.SurfaceTransferAmount * Acceptance);
+	}
+}
+
+void FALSXTFootstepEffectSettings::ApplyToFootprintStatePhase(FALSXTFootprintStatePhase& Phase) const
+{
+	Phase.TransferDetailTexture = TransferDetailTexture;
+	Phase.TransferPrimaryColor = TransferPrimaryColor;
+	Phase.TransferSecondaryColor = TransferSecondaryColor;
+	Phase.TransferWetness = TransferWetness;
+	Phase.TransferSaturationRate = TransferSaturationRate;
+	Phase.TransferDesaturationRate = TransferDesaturationRate;
+	Phase.TransferEmissiveAmount = TransferEmissive;
+	Phase.DecalDuration = DecalDuration;
+	Phase.DecalFadeOutDuration = DecalFadeOutDuration;
+	Phase.DecalDurationModifierMin = DecalDurationModifierMin;
+	Phase.DecalDurationModifierMax = DecalDurationModifierMax;
+	Phase.SurfaceTransferAcceptanceAmount = SurfaceTransferAcceptanceAmount;
+	Phase.TransferDetailScale = TransferDetailScale;
+	Phase.TransferAmount = TransferAmount;
+	Phase.SurfaceTransferAmount = SurfaceTransferAmount;
+	Phase.TransferNormalScale = TransferNormalScale;
+	Phase.TransferGrainSize = TransferGrainSize;
+	Phase.SurfaceTransferAcceptanceNormalScale = SurfaceTransferAcceptanceNormalScale;
+	Phase.TransferDetailNormalAmount = TransferDetailNormalAmount;
+}
+
+void UALSXTFootstepEffectsSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildEffectSettingsBySurface();
+}
+
+#if WITH_EDITOR
+void UALSXTFootstepEffectsSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	RebuildEffectSettingsBySurface();
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UALSXTFootstepEffectsSettings::RebuildEffectSettingsBySurface()
+{
+	UALSXTFootstepEffectsSubsystem::BuildEffectSettingsBySurface(Effects, EffectSettingsBySurface);
+}
+
+const FALSXTFootstepEffectSettings* UALSXTFootstepEffectsSettings::FindEffectSettings(const EPhysicalSurface SurfaceType) const
+{
+	// Settings that were never loaded or edited have no table.
+
+	return EffectSettingsBySurface.IsValidIndex(SurfaceType) ? EffectSettingsBySurface[SurfaceType] : nullptr;
+}
+
+void UALSXTFootstepEffectsSettings::GetEffectAssetPaths(TArray<FSoftObjectPath>& AssetPaths) const
+{
+	const auto AddAssetPath{
+		[&AssetPaths](const TSoftObjectPtr<UObject>& Asset)
+		{
+			if (!Asset.IsNull())
+			{
+				AssetPaths.AddUnique(Asset.ToSoftObjectPath());
+			}
+		}
+	};
+
+	for (const auto& Pair : Effects)
+	{
+		AddAssetPath(Pair.Value.Sound);
+		AddAssetPath(Pair.Value.DecalMaterial);
+		AddAssetPath(Pair.Value.ParticleSystem);
+		AddAssetPath(Pair.Value.FootstepParticles.WalkParticleSystem);
+		AddAssetPath(Pair.Value.FootstepParticles.RunParticleSystem);
+		AddAssetPath(Pair.Value.FootstepParticles.LandParticleSystem);
+	}
+}
 
 FString UALSXTAnimNotify_FootstepEffects::GetNotifyName_Implementation() const
 {
@@ -45,11 +215,31 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 {
 	Super::Notify(Mesh, Animation, EventReference);
 
+	if (!IsValid(Mesh))
+	{
+		return;
+	}
+
+	auto* EffectCommandSubsystem{Mesh->GetWorld()->GetSubsystem<UALSXTEffectCommandSubsystem>()};
+	if (IsValid(EffectCommandSubsystem))
+	{
+		EffectCommandSubsystem->RecordCommand(EALSXTEffectCommandType::Footstep, static_cast<uint8>(FootBone), this, Mesh);
+	}
+	else
+	{
+		SpawnEffects(Mesh);
+	}
+}
+
+void UALSXTAnimNotify_FootstepEffects::SpawnEffects(USkeletalMeshComponent* Mesh)
+{
 	if (!IsValid(Mesh) || !ALS_ENSURE(IsValid(FootstepEffectsSettings)))
 	{
 		return;
 	}
 
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_FootstepNotify, Mesh->GetOwner());
+
 	const auto* Character{Cast<AAlsCharacter>(Mesh->GetOwner())};
 	AALSXTCharacter* ALSXTCharacter{Cast<AALSXTCharacter>(Mesh->GetOwner())};
 
@@ -58,102 +248,37 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 		return;
 	}
 
-	const auto CapsuleScale{IsValid(ALSXTCharacter) ? ALSXTCharacter->GetCapsuleComponent()->GetComponentScale().Z : 1.0f};
-
 	const auto* World{Mesh->GetWorld()};
 	const auto* AnimationInstance{Mesh->GetAnimInstance()};
-	const auto* ALSXTAnimationInstance{ Cast<UALSXTAnimationInstance>(Mesh->GetAnimInstance()) };
 
-	const auto FootBoneName{FootBone == EALSXTFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
-	const auto FootTransform{Mesh->GetSocketTransform(FootBoneName)};
-
-	const auto FootZAxis{
-		FootTransform.TransformVectorNoScale(FootBone == EALSXTFootBone::Left
-												 ? FootstepEffectsSettings->FootLeftZAxis
-												 : FootstepEffectsSettings->FootRightZAxis)
-	};
-
-	FHitResult Hit;
-	bool NewSurface;
-	FVector HitLocation;
-	FVector HitNormal;
-	TWeakObjectPtr<UPrimitiveComponent> HitComponent;
-	TWeakObjectPtr<UPhysicalMaterial> HitPhysicalMaterial;
-
-#if ENABLE_DRAW_DEBUG
-	const auto bDisplayDebug{ UAlsUtility::ShouldDisplayDebugForActor(Mesh->GetOwner(), UAlsConstants::TracesDebugDisplayName()) };
-#endif
-
-	FCollisionQueryParams QueryParameters{ ANSI_TO_TCHAR(__FUNCTION__), true, Mesh->GetOwner() };
-	QueryParameters.bReturnPhysicalMaterial = true;
-
-	if (World->LineTraceSingleByChannel(Hit, FootTransform.GetLocation(),
-		FootTransform.GetLocation() - FootZAxis *
-		(FootstepEffectsSettings->SurfaceTraceDistance * CapsuleScale),
-		UEngineTypes::ConvertToCollisionChannel(FootstepEffectsSettings->SurfaceTraceChannel),
-		QueryParameters))
-	{
-		HitResult = Hit;
-		HitLocation = HitResult.ImpactPoint;
-		HitNormal = HitResult.ImpactNormal;
-		HitComponent = HitResult.Component;
-		HitPhysicalMaterial = HitResult.PhysMaterial;
-
-#if ENABLE_DRAW_DEBUG
-		if (bDisplayDebug)
-		{
-			UAlsUtility::DrawDebugLineTraceSingle(World, Hit.TraceStart, Hit.TraceEnd, Hit.bBlockingHit,
-				Hit, { 0.333333f, 0.0f, 0.0f }, FLinearColor::Red, 10.0f);
-		}
-#endif
-	}
-	else
+	auto* FootstepEffectsSubsystem{World->GetSubsystem<UALSXTFootstepEffectsSubsystem>()};
+	if (!IsValid(FootstepEffectsSubsystem))
 	{
-		HitResult.ImpactPoint = FootTransform.GetLocation();
-		Hit.ImpactPoint = FootTransform.GetLocation();
-		HitResult.ImpactNormal = FVector::UpVector;
-		Hit.ImpactNormal = FVector::UpVector;
-		HitLocation = FootTransform.GetLocation();
-		HitNormal = FVector::UpVector;
-		HitComponent = nullptr;
-		HitResult.Component = nullptr;
-		HitPhysicalMaterial = nullptr;
-		HitResult.PhysMaterial = nullptr;
+		return;
 	}
 
-	const auto SurfaceType{ HitResult.PhysMaterial.IsValid() ? HitResult.PhysMaterial->SurfaceType.GetValue() : SurfaceType_Default };
-	const auto* EffectSettings{ FootstepEffectsSettings->Effects.Find(SurfaceType) };
-
-	if (EffectSettings == nullptr)
+	if (IsValid(ALSXTCharacter))
 	{
-		for (const auto& Pair : FootstepEffectsSettings->Effects)
-		{
-			EffectSettings = &Pair.Value;
-			break;
-		}
-
-		if (EffectSettings == nullptr)
-		{
-			return;
-		}
+		ALSXTCharacter->SetFootprintsEffectsSettings(FootstepEffectsSettings);
 	}
 
-	const auto FootstepLocation{ HitResult.ImpactPoint };
+	// Effects whose assets are not loaded yet are skipped instead of loading them here.
 
-	const auto FootstepRotation{
-		FRotationMatrix::MakeFromZY(HitResult.ImpactNormal,
-									FootTransform.TransformVectorNoScale(FootBone == EALSXTFootBone::Left
-																			 ? FootstepEffectsSettings->FootLeftYAxis
-																			 : FootstepEffectsSettings->FootRightYAxis)).ToQuat()
-	};
+	FALSXTResolvedSurface Surface;
+	const auto* EffectSettings{FootstepEffectsSubsystem->ResolveSurfaceEffect(*Mesh, FootBone, *FootstepEffectsSettings, Surface)};
+
+	HitResult = Surface.Hit;
 
-#if ENABLE_DRAW_DEBUG
-	if (bDisplayDebug)
+	if (EffectSettings == nullptr)
 	{
-		DrawDebugCoordinateSystem(World, FootstepLocation, FootstepRotation.Rotator(),
-			25.0f, false, 10.0f, 0, UAlsUtility::DrawLineThickness);
+		return;
 	}
-#endif
+
+	const auto CapsuleScale{Surface.CapsuleScale};
+	const auto& FootBoneName{Surface.FootBoneName};
+	const auto SurfaceType{Surface.SurfaceType};
+	const auto& FootstepLocation{Surface.Location};
+	const auto& FootstepRotation{Surface.Rotation};
 
 	if (bSpawnSound)
 	{
@@ -164,7 +289,7 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 			VolumeMultiplier *= 1.0f - UAlsMath::Clamp01(AnimationInstance->GetCurveValue(UAlsConstants::FootstepSoundBlockCurveName()));
 		}
 
-		if (FAnimWeight::IsRelevant(VolumeMultiplier) && IsValid(EffectSettings->Sound.LoadSynchronous()))
+		if (FAnimWeight::IsRelevant(VolumeMultiplier) && IsValid(EffectSettings->Sound.Get()))
 		{
 			UAudioComponent* Audio{ nullptr };
 
@@ -198,7 +323,7 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 		}
 	}
 
-	if (bSpawnDecal && IsValid(EffectSettings->DecalMaterial.LoadSynchronous()))
+	if (bSpawnDecal && IsValid(EffectSettings->DecalMaterial.Get()))
 	{
 		const auto DecalRotation{
 			FootstepRotation * (FootBone == EALSXTFootBone::Left
@@ -210,268 +335,81 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 			FootstepLocation + DecalRotation.RotateVector(EffectSettings->DecalLocationOffset * CapsuleScale)
 		};
 
-		UDecalComponent* Decal;
+		auto* DecalAttachComponent{
+			EffectSettings->DecalSpawnType == EALSXTFootstepDecalSpawnType::SpawnAttachedToTraceHitComponent
+				? HitResult.Component.Get()
+				: nullptr
+		};
 
-		if (EffectSettings->DecalSpawnType == EALSXTFootstepDecalSpawnType::SpawnAttachedToTraceHitComponent && HitResult.Component.IsValid())
-		{
-			Decal = UGameplayStatics::SpawnDecalAttached(EffectSettings->DecalMaterial.Get(), EffectSettings->DecalSize * CapsuleScale,
-				HitResult.Component.Get(), NAME_None, DecalLocation,
-				DecalRotation.Rotator(), EAttachLocation::KeepWorldPosition);
-		}
-		else
-		{
-			Decal = UGameplayStatics::SpawnDecalAtLocation(World, EffectSettings->DecalMaterial.Get(),
-				EffectSettings->DecalSize * CapsuleScale,
-				DecalLocation, DecalRotation.Rotator());
-		}
+		// Only ALSXT characters set the footprint parameters, other characters use the decal material as is.
+
+		UMaterialInstanceDynamic* DecalMaterial;
 
-		if (IsValid(Decal))
+		auto* Decal{
+			FootstepEffectsSubsystem->SpawnFootprintDecal(EffectSettings->DecalMaterial.Get(), EffectSettings->DecalSize * CapsuleScale,
+			                                              DecalAttachComponent, DecalLocation, DecalRotation.Rotator(),
+			                                              IsValid(ALSXTCharacter), DecalMaterial)
+		};
+
+		if (IsValid(Decal) && IsValid(ALSXTCharacter))
 		{
-			if (IsValid(ALSXTCharacter)) {
-
-				CurrentFootprintsState = ALSXTCharacter->GetFootprintsState();
-
-				// Declare local variables
-				UMaterialInstanceDynamic* MI;
-				float CalculatedSoleNormalScale{ 0.0f };
-				float CalculatedTransferNormalScale{ 0.0f };
-				float DurationAverage{ 0.0f };
-				FVector2D InputRange{ 0, 1 };
-				FVector2D OutputRange{ 0, 1 };
-				float DurationModifier{ 0.0f };
-
-				// Set New Left or Right foot Values based on current FootBone
-				if (FootBone == EALSXTFootBone::Left) {
-
-					NewSurface = ((UGameplayStatics::GetSurfaceType(Hit) != CurrentFootprintsState.Left.Current.SurfaceType));
-
-					if (NewSurface) {
-
-						//Set Current as Previous
-						CurrentFootprintsState.Left.Previous = ALSXTCharacter->GetFootprintsState().Left.Current;
-
-						//Set New Current
-						CurrentFootprintsState.Left.Current.SurfaceType = UGameplayStatics::GetSurfaceType(Hit);
-						CurrentFootprintsState.Left.Current.TransferDetailTexture = EffectSettings->TransferDetailTexture;
-						CurrentFootprintsState.Left.Current.TransferDetailScale = EffectSettings->TransferDetailTextureScale;
-						CurrentFootprintsState.Left.Current.TransferPrimaryColor = EffectSettings->TransferPrimaryColor;
-						CurrentFootprintsState.Left.Current.TransferSecondaryColor = EffectSettings->TransferSecondaryColor;
-						CurrentFootprintsState.Left.Current.TransferWetness = EffectSettings->TransferWetness;
-						CurrentFootprintsState.Left.Current.TransferSaturationRate = EffectSettings->TransferSaturationRate;
-						CurrentFootprintsState.Left.Current.TransferDesaturationRate = EffectSettings->TransferDesaturationRate;
-						CurrentFootprintsState.Left.Current.TransferEmissiveAmount = EffectSettings->TransferEmissive;
-						CurrentFootprintsState.Left.Current.DecalDuration = EffectSettings->DecalDuration;
-						CurrentFootprintsState.Left.Current.DecalFadeOutDuration = EffectSettings->DecalFadeOutDuration;
-						CurrentFootprintsState.Left.Current.DecalDurationModifierMin = EffectSettings->DecalDurationModifierMin;
-						CurrentFootprintsState.Left.Current.DecalDurationModifierMax = EffectSettings->DecalDurationModifierMax;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAcceptanceAmount = EffectSettings->SurfaceTransferAcceptanceAmount;
-						CurrentFootprintsState.Left.Current.TransferDetailScale = EffectSettings->TransferDetailScale;
-						CurrentFootprintsState.Left.Current.TransferAmount = EffectSettings->TransferAmount;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAmount = EffectSettings->SurfaceTransferAmount;
-						CurrentFootprintsState.Left.Current.TransferNormalScale = EffectSettings->TransferNormalScale;
-						CurrentFootprintsState.Left.Current.TransferGrainSize = EffectSettings->TransferGrainSize;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAcceptanceNormalScale = EffectSettings->SurfaceTransferAcceptanceNormalScale;
-						CurrentFootprintsState.Left.Current.TransferDetailNormalAmount = EffectSettings->TransferDetailNormalAmount;
-					}
-					else {
-						//Set New Current
-						CurrentFootprintsState.Left.Current.SurfaceType = UGameplayStatics::GetSurfaceType(Hit);
-						CurrentFootprintsState.Left.Current.TransferDetailTexture = EffectSettings->TransferDetailTexture;
-						CurrentFootprintsState.Left.Current.TransferDetailScale = EffectSettings->TransferDetailTextureScale;
-						CurrentFootprintsState.Left.Current.TransferPrimaryColor = EffectSettings->TransferPrimaryColor;
-						CurrentFootprintsState.Left.Current.TransferSecondaryColor = EffectSettings->TransferSecondaryColor;
-						CurrentFootprintsState.Left.Current.TransferWetness = EffectSettings->TransferWetness;
-						CurrentFootprintsState.Left.Current.TransferSaturationRate = EffectSettings->TransferSaturationRate;
-						CurrentFootprintsState.Left.Current.TransferDesaturationRate = EffectSettings->TransferDesaturationRate;
-						CurrentFootprintsState.Left.Current.TransferEmissiveAmount = EffectSettings->TransferEmissive;
-						CurrentFootprintsState.Left.Current.DecalDuration = EffectSettings->DecalDuration;
-						CurrentFootprintsState.Left.Current.DecalFadeOutDuration = EffectSettings->DecalFadeOutDuration;
-						CurrentFootprintsState.Left.Current.DecalDurationModifierMin = EffectSettings->DecalDurationModifierMin;
-						CurrentFootprintsState.Left.Current.DecalDurationModifierMax = EffectSettings->DecalDurationModifierMax;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAcceptanceAmount = EffectSettings->SurfaceTransferAcceptanceAmount;
-						CurrentFootprintsState.Left.Current.TransferDetailScale = EffectSettings->TransferDetailScale;
-						CurrentFootprintsState.Left.Current.TransferAmount = EffectSettings->TransferAmount;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAmount = EffectSettings->SurfaceTransferAmount;
-						CurrentFootprintsState.Left.Current.TransferNormalScale = EffectSettings->TransferNormalScale;
-						CurrentFootprintsState.Left.Current.TransferGrainSize = EffectSettings->TransferGrainSize;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAcceptanceNormalScale = EffectSettings->SurfaceTransferAcceptanceNormalScale;
-						CurrentFootprintsState.Left.Current.TransferDetailNormalAmount = EffectSettings->TransferDetailNormalAmount;
-					}
-					CalculatedSoleNormalScale = (EffectSettings->TransferNormalScale + EffectSettings->SurfaceTransferAcceptanceNormalScale) * EffectSettings->SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount;
-					ALSXTCharacter->ProcessNewFootprintsState(EALSXTFootBone::Left, CurrentFootprintsState);
-					CurrentFootprintsState = ALSXTCharacter->GetFootprintsState();
-
-					
-					//Create Dynamic Material Instance and Set Parameters
-					MI = UMaterialInstanceDynamic::Create(Decal->GetMaterial(0), this);
-					Decal->SetMaterial(0, MI);
-
-					MI->SetTextureParameterValue(FName("SoleTexture"), ALSXTCharacter->GetFootwearDetails().FootwearSoleTexture);
-					MI->SetTextureParameterValue(FName("SoleNormal"), ALSXTCharacter->GetFootwearDetails().FootwearSoleNormalTexture);
-					MI->SetTextureParameterValue(FName("SoleDetail"), ALSXTCharacter->GetFootwearDetails().FootwearSoleDetailTexture);
-					MI->SetScalarParameterValue(FName("SoleNormalScale"), CalculatedSoleNormalScale);
-					MI->SetTextureParameterValue(FName("TransferDetailTexture"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferDetailTexture);
-					MI->SetTextureParameterValue(FName("TransferDetailNormal"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferDetailNormal);
-					MI->SetScalarParameterValue(FName("TransferNormalScale"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferNormalScale * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("TransferDetailScale"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferDetailScale);
-					MI->SetScalarParameterValue(FName("Opacity"), EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetVectorParameterValue(FName("PrimaryColor"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferPrimaryColor);
-					MI->SetVectorParameterValue(FName("SecondaryColor"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferSecondaryColor);
-					MI->SetScalarParameterValue(FName("GrainSize"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferGrainSize);
-					MI->SetScalarParameterValue(FName("Wetness"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferWetness * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("EmissiveAmount"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferEmissiveAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetTextureParameterValue(FName("TransferDetailTexturePrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferDetailTexture);
-					MI->SetTextureParameterValue(FName("TransferDetailNormalPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferDetailNormal);
-					MI->SetScalarParameterValue(FName("TransferNormalScalePrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferNormalScale* EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("TransferDetailScalePrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferDetailScale);
-					MI->SetVectorParameterValue(FName("PrimaryColorPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferPrimaryColor);
-					MI->SetVectorParameterValue(FName("SecondaryColorPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferSecondaryColor);
-					MI->SetScalarParameterValue(FName("GrainSizePrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferGrainSize);
-					MI->SetScalarParameterValue(FName("WetnessPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferWetness * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("EmissiveAmountPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferEmissiveAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("PhaseAlpha"), ALSXTCharacter->GetFootprintsState().Left.FootSurfaceAlpha);
-					MI->SetScalarParameterValue(FName("TransferAmount"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("SurfaceTransferAmount"), ALSXTCharacter->GetFootprintsState().Left.Current.SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("TransferAmountPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("SurfaceTransferAmountPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-
-					//Calculate Duration based on Materials. Wetter materials stay longer
-					DurationAverage = ALSXTCharacter->GetFootprintsState().Left.Current.TransferWetness + EffectSettings->SurfaceTransferAmount / 2;
-					InputRange = { 0, 1 };
-					OutputRange = { EffectSettings->DecalDurationModifierMin, EffectSettings->DecalDurationModifierMax };
-					DurationModifier = FMath::GetMappedRangeValueClamped(InputRange, OutputRange, DurationAverage);
-					Decal->SetFadeOut(EffectSettings->DecalDuration, EffectSettings->DecalFadeOutDuration* DurationModifier, false);
-				}
-				if (FootBone == EALSXTFootBone::Right) {
-
-					NewSurface = ((UGameplayStatics::GetSurfaceType(Hit) != CurrentFootprintsState.Right.Current.SurfaceType));
-
-					if (NewSurface) {
-
-						//Set Current as Previous
-
-						CurrentFootprintsState.Right.Previous = ALSXTCharacter->GetFootprintsState().Right.Current;
-
-						// CurrentFootprintsState.Right.Previous.TransferSaturationRate = ALSXTCharacter->GetFootprintsState().Right.Current.TransferSaturationRate;
-
-						//Set New Current
-						CurrentFootprintsState.Right.Current.SurfaceType = UGameplayStatics::GetSurfaceType(Hit);
-						CurrentFootprintsState.Right.Current.TransferDetailTexture = EffectSettings->TransferDetailTexture;
-						CurrentFootprintsState.Right.Current.TransferDetailScale = EffectSettings->TransferDetailTextureScale;
-						CurrentFootprintsState.Right.Current.TransferPrimaryColor = EffectSettings->TransferPrimaryColor;
-						CurrentFootprintsState.Right.Current.TransferSecondaryColor = EffectSettings->TransferSecondaryColor;
-						CurrentFootprintsState.Right.Current.TransferWetness = EffectSettings->TransferWetness;
-						CurrentFootprintsState.Right.Current.TransferSaturationRate = EffectSettings->TransferSaturationRate;
-						CurrentFootprintsState.Right.Current.TransferDesaturationRate = EffectSettings->TransferDesaturationRate;
-						CurrentFootprintsState.Right.Current.TransferEmissiveAmount = EffectSettings->TransferEmissive;
-						CurrentFootprintsState.Right.Current.DecalDuration = EffectSettings->DecalDuration;
-						CurrentFootprintsState.Right.Current.DecalFadeOutDuration = EffectSettings->DecalFadeOutDuration;
-						CurrentFootprintsState.Right.Current.DecalDurationModifierMin = EffectSettings->DecalDurationModifierMin;
-						CurrentFootprintsState.Right.Current.DecalDurationModifierMax = EffectSettings->DecalDurationModifierMax;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAcceptanceAmount = EffectSettings->SurfaceTransferAcceptanceAmount;
-						CurrentFootprintsState.Right.Current.TransferDetailScale = EffectSettings->TransferDetailScale;
-						CurrentFootprintsState.Right.Current.TransferAmount = EffectSettings->TransferAmount;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAmount = EffectSettings->SurfaceTransferAmount;
-						CurrentFootprintsState.Right.Current.TransferNormalScale = EffectSettings->TransferNormalScale;
-						CurrentFootprintsState.Right.Current.TransferGrainSize = EffectSettings->TransferGrainSize;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAcceptanceNormalScale = EffectSettings->SurfaceTransferAcceptanceNormalScale;
-						CurrentFootprintsState.Right.Current.TransferDetailNormalAmount = EffectSettings->TransferDetailNormalAmount;
-					}
-					else {
-						//Set New Current
-						CurrentFootprintsState.Right.Current.SurfaceType = UGameplayStatics::GetSurfaceType(Hit);
-						CurrentFootprintsState.Right.Current.TransferDetailTexture = EffectSettings->TransferDetailTexture;
-						CurrentFootprintsState.Right.Current.TransferDetailScale = EffectSettings->TransferDetailTextureScale;
-						CurrentFootprintsState.Right.Current.TransferPrimaryColor = EffectSettings->TransferPrimaryColor;
-						CurrentFootprintsState.Right.Current.TransferSecondaryColor = EffectSettings->TransferSecondaryColor;
-						CurrentFootprintsState.Right.Current.TransferWetness = EffectSettings->TransferWetness;
-						CurrentFootprintsState.Right.Current.TransferSaturationRate = EffectSettings->TransferSaturationRate;
-						CurrentFootprintsState.Right.Current.TransferDesaturationRate = EffectSettings->TransferDesaturationRate;
-						CurrentFootprintsState.Right.Current.TransferEmissiveAmount = EffectSettings->TransferEmissive;
-						CurrentFootprintsState.Right.Current.DecalDuration = EffectSettings->DecalDuration;
-						CurrentFootprintsState.Right.Current.DecalFadeOutDuration = EffectSettings->DecalFadeOutDuration;
-						CurrentFootprintsState.Right.Current.DecalDurationModifierMin = EffectSettings->DecalDurationModifierMin;
-						CurrentFootprintsState.Right.Current.DecalDurationModifierMax = EffectSettings->DecalDurationModifierMax;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAcceptanceAmount = EffectSettings->SurfaceTransferAcceptanceAmount;
-						CurrentFootprintsState.Right.Current.TransferDetailScale = EffectSettings->SurfaceTransferAcceptanceNormalScale;
-						CurrentFootprintsState.Right.Current.TransferDetailScale = EffectSettings->TransferDetailScale;
-						CurrentFootprintsState.Right.Current.TransferAmount = EffectSettings->TransferAmount;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAmount = EffectSettings->SurfaceTransferAmount;
-						CurrentFootprintsState.Right.Current.TransferNormalScale = EffectSettings->TransferNormalScale;
-						CurrentFootprintsState.Right.Current.TransferGrainSize = EffectSettings->TransferGrainSize;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAcceptanceNormalScale = EffectSettings->SurfaceTransferAcceptanceNormalScale;
-						CurrentFootprintsState.Right.Current.TransferDetailNormalAmount = EffectSettings->TransferDetailNormalAmount;
-					}
-					CalculatedSoleNormalScale = (EffectSettings->TransferNormalScale + EffectSettings->SurfaceTransferAcceptanceNormalScale) * EffectSettings->SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount;
-					ALSXTCharacter->ProcessNewFootprintsState(EALSXTFootBone::Right, CurrentFootprintsState);
-					CurrentFootprintsState = ALSXTCharacter->GetFootprintsState();
-
-					//Create Dynamic Material Instance and Set Parameters
-					MI = UMaterialInstanceDynamic::Create(Decal->GetMaterial(0), this);
-					Decal->SetMaterial(0, MI);
-
-					MI->SetTextureParameterValue(FName("SoleTexture"), ALSXTCharacter->GetFootwearDetails().FootwearSoleTexture);
-					MI->SetTextureParameterValue(FName("SoleNormal"), ALSXTCharacter->GetFootwearDetails().FootwearSoleNormalTexture);
-					MI->SetTextureParameterValue(FName("SoleDetail"), ALSXTCharacter->GetFootwearDetails().FootwearSoleDetailTexture);
-					MI->SetScalarParameterValue(FName("SoleNormalScale"), CalculatedSoleNormalScale);
-					MI->SetTextureParameterValue(FName("TransferDetailTexture"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferDetailTexture);
-					MI->SetTextureParameterValue(FName("TransferDetailNormal"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferDetailNormal);
-					MI->SetScalarParameterValue(FName("TransferNormalScale"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferNormalScale * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("TransferDetailScale"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferDetailScale);
-					MI->SetScalarParameterValue(FName("Opacity"), EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetVectorParameterValue(FName("PrimaryColor"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferPrimaryColor);
-					MI->SetVectorParameterValue(FName("SecondaryColor"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferSecondaryColor);
-					MI->SetScalarParameterValue(FName("GrainSize"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferGrainSize);
-					MI->SetScalarParameterValue(FName("Wetness"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferWetness * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("EmissiveAmount"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferEmissiveAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetTextureParameterValue(FName("TransferDetailTexturePrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferDetailTexture);
-					MI->SetTextureParameterValue(FName("TransferDetailNormalPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferDetailNormal);
-					MI->SetScalarParameterValue(FName("TransferNormalScalePrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferNormalScale);
-					MI->SetScalarParameterValue(FName("TransferDetailScalePrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferDetailScale);
-					MI->SetVectorParameterValue(FName("PrimaryColorPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferPrimaryColor);
-					MI->SetVectorParameterValue(FName("SecondaryColorPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferSecondaryColor);
-					MI->SetScalarParameterValue(FName("GrainSizePrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferGrainSize);
-					MI->SetScalarParameterValue(FName("WetnessPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferWetness * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("EmissiveAmountPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferEmissiveAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("PhaseAlpha"), ALSXTCharacter->GetFootprintsState().Right.FootSurfaceAlpha);
-					MI->SetScalarParameterValue(FName("TransferAmount"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("SurfaceTransferAmount"), ALSXTCharacter->GetFootprintsState().Right.Current.SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("TransferAmountPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("SurfaceTransferAmountPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-
-					//Calculate Duration based on Materials. Wetter materials stay longer
-					DurationAverage = ALSXTCharacter->GetFootprintsState().Right.Current.TransferWetness + EffectSettings->SurfaceTransferAmount / 2;
-					InputRange = { 0, 1 };
-					OutputRange = { EffectSettings->DecalDurationModifierMin, EffectSettings->DecalDurationModifierMax };
-					DurationModifier = FMath::GetMappedRangeValueClamped(InputRange, OutputRange, DurationAverage);
-					Decal->SetFadeOut(EffectSettings->DecalDuration, EffectSettings->DecalFadeOutDuration * DurationModifier, false);	
-				}
-			}
-			else
-			{
-			if (GEngine)
+			CurrentFootprintsState = ALSXTCharacter->GetFootprintsState();
+
+			auto& FootprintState{FootBone == EALSXTFootBone::Left ? CurrentFootprintsState.Left : CurrentFootprintsState.Right};
+
+			if (SurfaceType != FootprintState.Current.SurfaceType)
 			{
-				// GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Yellow, TEXT("Some debug message!"));	
-			}
+				FootprintState.Previous = FootprintState.Current;
 			}
+
+			EffectSettings->ApplyToFootprintStatePhase(FootprintState.Current);
+			FootprintState.Current.SurfaceType = SurfaceType;
+
+			ALSXTCharacter->ProcessNewFootprintsState(FootBone, CurrentFootprintsState);
+			CurrentFootprintsState = ALSXTCharacter->GetFootprintsState();
+
+			const auto& ProcessedFootprintState{
+				FootBone == EALSXTFootBone::Left ? CurrentFootprintsState.Left : CurrentFootprintsState.Right
+			};
+
+			ALSXTFootstepEffects::SetFootprintDecalParameters(*DecalMaterial, FootBone, ALSXTCharacter->GetFootwearDetails(),
+			                                                  ProcessedFootprintState, *EffectSettings);
+
+			// Wetter materials stay longer.
+
+			const auto DurationAverage{ProcessedFootprintState.Current.TransferWetness + EffectSettings->SurfaceTransferAmount / 2};
+
+			const auto DurationModifier{
+				FMath::GetMappedRangeValueClamped(FVector2f{0.0f, 1.0f},
+				                                  FVector2f{EffectSettings->DecalDurationModifierMin, EffectSettings->DecalDurationModifierMax},
+				                                  DurationAverage)
+			};
+
+			UALSXTFootstepEffectsSubsystem::SetFootprintDecalFadeOut(Decal, EffectSettings->DecalDuration,
+			                                                         EffectSettings->DecalFadeOutDuration * DurationModifier);
 		}
 	}
 
-	if (bSpawnParticleSystem && IsValid(EffectSettings->ParticleSystem.LoadSynchronous()) && IsValid(EffectSettings->FootstepParticles.WalkParticleSystem.LoadSynchronous()) && IsValid(EffectSettings->FootstepParticles.RunParticleSystem.LoadSynchronous()) && IsValid(EffectSettings->FootstepParticles.LandParticleSystem.LoadSynchronous()))
+	auto* EffectSpawnSubsystem{World->GetSubsystem<UALSXTEffectSpawnSubsystem>()};
+
+	if (bSpawnParticleSystem && IsValid(EffectSpawnSubsystem) && IsValid(EffectSettings->ParticleSystem.Get()) && IsValid(EffectSettings->FootstepParticles.WalkParticleSystem.Get()) && IsValid(EffectSettings->FootstepParticles.RunParticleSystem.Get()) && IsValid(EffectSettings->FootstepParticles.LandParticleSystem.Get()))
 	{
 		UNiagaraSystem* GaitParticleSystem;
 		if (IsValid(ALSXTCharacter)) {
-			if (ALSXTCharacter->GetDesiredGait() == AlsGaitTags::Walking)
+			switch (ALSXTGameplayTagEnumUtility::ToEnum<EALSXTGait>(ALSXTCharacter->GetDesiredGait()))
 			{
+			case EALSXTGait::Walking:
 				GaitParticleSystem = EffectSettings->FootstepParticles.WalkParticleSystem.Get();
-			}
-			else if (ALSXTCharacter->GetDesiredGait() == AlsGaitTags::Running || ALSXTCharacter->GetDesiredGait() == AlsGaitTags::Sprinting)
-			{
+				break;
+
+			case EALSXTGait::Running:
+			case EALSXTGait::Sprinting:
 				GaitParticleSystem = EffectSettings->FootstepParticles.RunParticleSystem.Get();
-			}
-			else
-			{
+				break;
+
+			default:
 				GaitParticleSystem = EffectSettings->FootstepParticles.LandParticleSystem.Get();
+				break;
 			}
 		}
 		else
@@ -494,18 +432,17 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 				ParticleSystemRotation.RotateVector(EffectSettings->ParticleSystemLocationOffset * CapsuleScale)
 			};
 
-			UNiagaraFunctionLibrary::SpawnSystemAtLocation(World, EffectSettings->ParticleSystem.Get(),
+			EffectSpawnSubsystem->SpawnSystemAtLocation(EALSXTEffectSpawnType::Footstep, EffectSettings->ParticleSystem.Get(),
 				ParticleSystemLocation, ParticleSystemRotation.Rotator(),
-				FVector::OneVector * CapsuleScale, true, true, ENCPoolMethod::AutoRelease);
+				FVector::OneVector * CapsuleScale, Mesh);
 		}
 		break;
 
 		case EALSXTFootstepParticleEffectSpawnType::SpawnAttachedToFootBone:
-			UNiagaraFunctionLibrary::SpawnSystemAttached(EffectSettings->ParticleSystem.Get(), Mesh, FootBoneName,
+			EffectSpawnSubsystem->SpawnSystemAttached(EALSXTEffectSpawnType::Footstep, EffectSettings->ParticleSystem.Get(), Mesh, FootBoneName,
 				EffectSettings->ParticleSystemLocationOffset * CapsuleScale,
 				EffectSettings->ParticleSystemFootLeftRotationOffset,
-				FVector::OneVector * CapsuleScale, EAttachLocation::KeepRelativeOffset,
-				true, ENCPoolMethod::AutoRelease);
+				FVector::OneVector * CapsuleScale, EAttachLocation::KeepRelativeOffset);
 			break;
 		}
 	}
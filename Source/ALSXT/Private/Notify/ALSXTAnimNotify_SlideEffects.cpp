@@ -6,9 +6,7 @@
 #include "AlsCharacter.h"
 #include "ALSXTAnimationInstance.h"
 #include "ALSXTCharacter.h"
-#include "DrawDebugHelpers.h"
 #include "NiagaraComponent.h"
-#include "NiagaraFunctionLibrary.h"
 #include "Animation/AnimInstance.h"
 #include "Components/AudioComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -21,10 +19,62 @@
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMath.h"
 #include "Utility/AlsUtility.h"
+#include "Subsystems/ALSXTEffectCommandSubsystem.h"
+#include "Subsystems/ALSXTEffectSpawnSubsystem.h"
+#include "Subsystems/ALSXTFootstepEffectsSubsystem.h"
+#include "Utility/ALSXTStats.h"
 
 // ReSharper disable once CppUnusedIncludeDirective
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTAnimNotify_SlideEffects)
 
+void UALSXTSlideEffectsSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildEffectSettingsBySurface();
+}
+
+#if WITH_EDITOR
+void UALSXTSlideEffectsSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	RebuildEffectSettingsBySurface();
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UALSXTSlideEffectsSettings::RebuildEffectSettingsBySurface()
+{
+	UALSXTFootstepEffectsSubsystem::BuildEffectSettingsBySurface(Effects, EffectSettingsBySurface);
+}
+
+const FALSXTSlideEffectSettings* UALSXTSlideEffectsSettings::FindEffectSettings(const EPhysicalSurface SurfaceType) const
+{
+	// Settings that were never loaded or edited have no table.
+
+	return EffectSettingsBySurface.IsValidIndex(SurfaceType) ? EffectSettingsBySurface[SurfaceType] : nullptr;
+}
+
+void UALSXTSlideEffectsSettings::GetEffectAssetPaths(TArray<FSoftObjectPath>& AssetPaths) const
+{
+	const auto AddAssetPath{
+		[&AssetPaths](const TSoftObjectPtr<UObject>& Asset)
+		{
+			if (!Asset.IsNull())
+			{
+				AssetPaths.AddUnique(Asset.ToSoftObjectPath());
+			}
+		}
+	};
+
+	for (const auto& Pair : Effects)
+	{
+		AddAssetPath(Pair.Value.Sound);
+		AddAssetPath(Pair.Value.DecalMaterial);
+		AddAssetPath(Pair.Value.ParticleSystem);
+	}
+}
+
 FString UALSXTAnimNotify_SlideEffects::GetNotifyName_Implementation() const
 {
 	return FString("ALSXT Slide Effects");
@@ -35,11 +85,31 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 {
 	Super::Notify(Mesh, Animation, EventReference);
 
+	if (!IsValid(Mesh))
+	{
+		return;
+	}
+
+	auto* EffectCommandSubsystem{Mesh->GetWorld()->GetSubsystem<UALSXTEffectCommandSubsystem>()};
+	if (IsValid(EffectCommandSubsystem))
+	{
+		EffectCommandSubsystem->RecordCommand(EALSXTEffectCommandType::Slide, static_cast<uint8>(FootBone), this, Mesh);
+	}
+	else
+	{
+		SpawnEffects(Mesh);
+	}
+}
+
+void UALSXTAnimNotify_SlideEffects::SpawnEffects(USkeletalMeshComponent* Mesh)
+{
 	if (!IsValid(Mesh) || !ALS_ENSURE(IsValid(SlideEffectsSettings)))
 	{
 		return;
 	}
 
+	ALSXT_SCOPE_CYCLE_COUNTER(STAT_ALSXT_EffectNotify, Mesh->GetOwner());
+
 	const auto* Character{ Cast<AAlsCharacter>(Mesh->GetOwner()) };
 	AALSXTCharacter* ALSXTCharacter{ Cast<AALSXTCharacter>(Mesh->GetOwner()) };
 
@@ -48,104 +118,31 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 		return;
 	}
 
-	const auto CapsuleScale{ IsValid(ALSXTCharacter) ? ALSXTCharacter->GetCapsuleComponent()->GetComponentScale().Z : 1.0f };
-
 	const auto* World{ Mesh->GetWorld() };
 	const auto* AnimationInstance{ Mesh->GetAnimInstance() };
-	const auto* ALSXTAnimationInstance{ Cast<UALSXTAnimationInstance>(Mesh->GetAnimInstance()) };
-
-	const auto FootBoneName{FootBone == EALSXTFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
-	const auto FootTransform{Mesh->GetSocketTransform(FootBoneName)};
-
-	const auto FootZAxis{
-		FootTransform.TransformVectorNoScale(FootBone == EALSXTFootBone::Left
-												 ? SlideEffectsSettings->FootLeftZAxis
-												 : SlideEffectsSettings->FootRightZAxis)
-	};
-
-	FHitResult Hit;
-	FVector HitLocation;
-	FVector HitNormal;
-	TWeakObjectPtr<UPrimitiveComponent> HitComponent;
-	TWeakObjectPtr<UPhysicalMaterial> HitPhysicalMaterial;
-	TEnumAsByte<EPhysicalSurface> HitSurface;
 
-#if ENABLE_DRAW_DEBUG
-	const auto bDisplayDebug{ UAlsUtility::ShouldDisplayDebugForActor(Mesh->GetOwner(), UAlsConstants::TracesDebugDisplayName()) };
-#endif
-
-	FCollisionQueryParams QueryParameters{ ANSI_TO_TCHAR(__FUNCTION__), true, Mesh->GetOwner() };
-	QueryParameters.bReturnPhysicalMaterial = true;
-
-	if (World->LineTraceSingleByChannel(Hit, FootTransform.GetLocation(),
-		FootTransform.GetLocation() - FootZAxis *
-		(SlideEffectsSettings->SurfaceTraceDistance * CapsuleScale),
-		UEngineTypes::ConvertToCollisionChannel(SlideEffectsSettings->SurfaceTraceChannel),
-		QueryParameters))
-	{
-		HitResult = Hit;
-		HitLocation = HitResult.ImpactPoint;
-		HitNormal = HitResult.ImpactNormal;
-		HitComponent = HitResult.Component;
-		HitPhysicalMaterial = HitResult.PhysMaterial;
-		HitSurface = UGameplayStatics::GetSurfaceType(Hit);
-
-#if ENABLE_DRAW_DEBUG
-		if (bDisplayDebug)
-		{
-			UAlsUtility::DrawDebugLineTraceSingle(World, Hit.TraceStart, Hit.TraceEnd, Hit.bBlockingHit,
-				Hit, { 0.333333f, 0.0f, 0.0f }, FLinearColor::Red, 10.0f);
-		}
-#endif
-	}
-	else
+	auto* FootstepEffectsSubsystem{World->GetSubsystem<UALSXTFootstepEffectsSubsystem>()};
+	if (!IsValid(FootstepEffectsSubsystem))
 	{
-		HitResult.ImpactPoint = FootTransform.GetLocation();
-		Hit.ImpactPoint = FootTransform.GetLocation();
-		HitResult.ImpactNormal = FVector::UpVector;
-		Hit.ImpactNormal = FVector::UpVector;
-		HitLocation = FootTransform.GetLocation();
-		HitNormal = FVector::UpVector;
-		HitComponent = nullptr;
-		HitResult.Component = nullptr;
-		HitPhysicalMaterial = nullptr;
-		HitResult.PhysMaterial = nullptr;
-		HitSurface = SurfaceType_Default;
+		return;
 	}
 
-	const auto SurfaceType{ HitSurface };
-	const auto* EffectSettings{ SlideEffectsSettings->Effects.Find(SurfaceType) };
+	// Effects whose assets are not loaded yet are skipped instead of loading them here.
 
-	if (EffectSettings == nullptr)
-	{
-		for (const auto& Pair : SlideEffectsSettings->Effects)
-		{
-			EffectSettings = &Pair.Value;
-			break;
-		}
+	FALSXTResolvedSurface Surface;
+	const auto* EffectSettings{FootstepEffectsSubsystem->ResolveSurfaceEffect(*Mesh, FootBone, *SlideEffectsSettings, Surface)};
 
-		if (EffectSettings == nullptr)
-		{
-			return;
-		}
-	}
+	HitResult = Surface.Hit;
 
-	const auto FootstepLocation{ HitResult.ImpactPoint };
-
-	const auto FootstepRotation{
-		FRotationMatrix::MakeFromZY(HitResult.ImpactNormal,
-									FootTransform.TransformVectorNoScale(FootBone == EALSXTFootBone::Left
-																			 ? SlideEffectsSettings->FootLeftYAxis
-																			 : SlideEffectsSettings->FootRightYAxis)).ToQuat()
-	};
-
-#if ENABLE_DRAW_DEBUG
-	if (bDisplayDebug)
+	if (EffectSettings == nullptr)
 	{
-		DrawDebugCoordinateSystem(World, FootstepLocation, FootstepRotation.Rotator(),
-			25.0f, false, 10.0f, 0, UAlsUtility::DrawLineThickness);
+		return;
 	}
-#endif
+
+	const auto CapsuleScale{Surface.CapsuleScale};
+	const auto& FootBoneName{Surface.FootBoneName};
+	const auto& FootstepLocation{Surface.Location};
+	const auto& FootstepRotation{Surface.Rotation};
 
 	if (bSpawnSound)
 	{
@@ -156,7 +153,7 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 			VolumeMultiplier *= 1.0f - UAlsMath::Clamp01(AnimationInstance->GetCurveValue(UAlsConstants::FootstepSoundBlockCurveName()));
 		}
 
-		if (FAnimWeight::IsRelevant(VolumeMultiplier) && IsValid(EffectSettings->Sound.LoadSynchronous()))
+		if (FAnimWeight::IsRelevant(VolumeMultiplier) && IsValid(EffectSettings->Sound.Get()))
 		{
 			UAudioComponent* Audio{ nullptr };
 
@@ -185,7 +182,9 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 		}
 	}
 
-	if (bSpawnParticleSystem && IsValid(EffectSettings->ParticleSystem.LoadSynchronous()))
+	auto* EffectSpawnSubsystem{World->GetSubsystem<UALSXTEffectSpawnSubsystem>()};
+
+	if (bSpawnParticleSystem && IsValid(EffectSpawnSubsystem) && IsValid(EffectSettings->ParticleSystem.Get()))
 	{
 		switch (EffectSettings->ParticleSystemSpawnType)
 		{
@@ -202,18 +201,17 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 				ParticleSystemRotation.RotateVector(EffectSettings->ParticleSystemLocationOffset * CapsuleScale)
 			};
 
-			UNiagaraFunctionLibrary::SpawnSystemAtLocation(World, EffectSettings->ParticleSystem.Get(),
+			EffectSpawnSubsystem->SpawnSystemAtLocation(EALSXTEffectSpawnType::Slide, EffectSettings->ParticleSystem.Get(),
 				ParticleSystemLocation, ParticleSystemRotation.Rotator(),
-				FVector::OneVector * CapsuleScale, true, true, ENCPoolMethod::AutoRelease);
+				FVector::OneVector * CapsuleScale, Mesh);
 		}
 		break;
 
 		case EALSXTFootstepParticleEffectSpawnType::SpawnAttachedToFootBone:
-			UNiagaraFunctionLibrary::SpawnSystemAttached(EffectSettings->ParticleSystem.Get(), Mesh, FootBoneName,
+			EffectSpawnSubsystem->SpawnSystemAttached(EALSXTEffectSpawnType::Slide, EffectSettings->ParticleSystem.Get(), Mesh, FootBoneName,
 				EffectSettings->ParticleSystemLocationOffset * CapsuleScale,
 				EffectSettings->ParticleSystemFootLeftRotationOffset,
-				FVector::OneVector * CapsuleScale, EAttachLocation::KeepRelativeOffset,
-				true, ENCPoolMethod::AutoRelease);
+				FVector::OneVector * CapsuleScale, EAttachLocation::KeepRelativeOffset);
 			break;
 		}
 	}
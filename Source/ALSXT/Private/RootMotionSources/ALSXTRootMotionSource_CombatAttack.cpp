@@ -3,9 +3,8 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Curves/CurveFloat.h"
 #include "Curves/CurveVector.h"
-#include "Kismet/KismetSystemLibrary.h" 
 #include "GameFramework/Character.h"
-#include "ALSXTCharacter.h"
+#include "Components/Character/ALSXTCombatComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Settings/ALSXTCombatSettings.h"
 #include "Utility/AlsMacros.h"
@@ -37,17 +36,44 @@ bool FALSXTRootMotionSource_CombatAttack::Matches(const FRootMotionSource* Other
 	       TargetPrimitive == OtherCasted->TargetPrimitive;
 }
 
+void FALSXTRootMotionSource_CombatAttack::CaptureCombatState(const ACharacter& Character)
+{
+	const auto* Component{Character.FindComponentByClass<UALSXTCombatComponent>()};
+
+	if (IsValid(Component))
+	{
+		CombatState = Component->GetCombatState();
+	}
+	else if (Character.Implements<UALSXTCombatInterface>())
+	{
+		CombatState = IALSXTCombatInterface::Execute_GetCombatState(const_cast<ACharacter*>(&Character));
+	}
+}
+
+void FALSXTRootMotionSource_CombatAttack::BakeCurveTable()
+{
+	const auto& Animation{CombatState.CombatParameters.CombatAnimation};
+
+	const auto NewCurveTable{MakeShared<FALSXTRootMotionCurveTable>()};
+	NewCurveTable->Bake(Animation.BlendInCurve, Animation.InterpolationAndCorrectionAmountsCurve,
+	                    CombatSettings->CalculatePlayRate(Animation.ReferenceHeight, Animation.PlayRate, AttackHeight),
+	                    CombatSettings->CalculateStartTime(Animation.ReferenceHeight, Animation.StartTime, AttackHeight));
+
+	CurveTable = NewCurveTable;
+}
+
 void FALSXTRootMotionSource_CombatAttack::PrepareRootMotion(const float SimulationDeltaTime, const float DeltaTime,
                                                       const ACharacter& Character, const UCharacterMovementComponent& Movement)
 {
-	const AALSXTCharacter& ALSXTCharacter = dynamic_cast<const AALSXTCharacter&>(Character);
-	AALSXTCharacter* ALSXTCharacterObject = Cast<AALSXTCharacter>(Character._getUObject());
-
-	if (UKismetSystemLibrary::DoesImplementInterface(ALSXTCharacterObject, UALSXTCombatInterface::StaticClass()))
+	if (!CurveTable.IsValid())
 	{
-		CombatState = IALSXTCombatInterface::Execute_GetCombatState(ALSXTCharacterObject);
+		// Sources that were not fully initialized on creation (for example, received over the network)
+		// capture the combat state from the character once instead of on every simulation step.
+
+		CaptureCombatState(Character);
+		BakeCurveTable();
 	}
-	
+
 	SetTime(GetTime() + SimulationDeltaTime);
 
 	if (!ALS_ENSURE(Duration > SMALL_NUMBER) || DeltaTime <= SMALL_NUMBER)
@@ -56,7 +82,7 @@ void FALSXTRootMotionSource_CombatAttack::PrepareRootMotion(const float Simulati
 		return;
 	}
 
-	const auto AttackTime{GetTime() * CombatSettings->CalculatePlayRate(CombatState.CombatParameters.CombatAnimation.ReferenceHeight, CombatState.CombatParameters.CombatAnimation.PlayRate, AttackHeight)};
+	const auto AttackTime{GetTime() * CurveTable->PlayRate};
 
 	// Calculate target transform from the stored relative transform to follow along with moving objects.
 
@@ -70,7 +96,7 @@ void FALSXTRootMotionSource_CombatAttack::PrepareRootMotion(const float Simulati
 	FVector LocationOffset;
 	FRotator RotationOffset;
 
-	const auto BlendInAmount{CombatState.CombatParameters.CombatAnimation.BlendInCurve->GetFloatValue(AttackTime)};
+	const auto BlendInAmount{CurveTable->GetBlendInAmount(AttackTime)};
 
 	if (!FAnimWeight::IsRelevant(BlendInAmount))
 	{
@@ -79,10 +105,7 @@ void FALSXTRootMotionSource_CombatAttack::PrepareRootMotion(const float Simulati
 	}
 	else
 	{
-		const FVector3f InterpolationAndCorrectionAmounts{
-			CombatState.CombatParameters.CombatAnimation.InterpolationAndCorrectionAmountsCurve->GetVectorValue(
-				AttackTime + CombatSettings->CalculateStartTime(CombatState.CombatParameters.CombatAnimation.ReferenceHeight, CombatState.CombatParameters.CombatAnimation.StartTime, AttackHeight))
-		};
+		const auto InterpolationAndCorrectionAmounts{CurveTable->GetInterpolationAndCorrectionAmounts(AttackTime)};
 
 		const auto InterpolationAmount{InterpolationAndCorrectionAmounts.X};
 		const auto HorizontalCorrectionAmount{InterpolationAndCorrectionAmounts.Y};
@@ -168,6 +191,11 @@ bool FALSXTRootMotionSource_CombatAttack::NetSerialize(FArchive& Archive, UPacka
 
 	Archive << AttackHeight;
 
+	if (Archive.IsLoading())
+	{
+		CurveTable.Reset();
+	}
+
 	return bSuccess;
 }
 
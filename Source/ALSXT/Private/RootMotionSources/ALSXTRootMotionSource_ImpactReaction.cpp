@@ -3,9 +3,8 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Curves/CurveFloat.h"
 #include "Curves/CurveVector.h"
-#include "Kismet/KismetSystemLibrary.h" 
 #include "GameFramework/Character.h"
-#include "ALSXTCharacter.h"
+#include "Components/Character/ALSXTImpactReactionComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Settings/ALSXTImpactReactionSettings.h"
 #include "Utility/AlsMacros.h"
@@ -34,17 +33,44 @@ bool FALSXTRootMotionSource_ImpactReaction::Matches(const FRootMotionSource* Oth
 	       TargetPrimitive == OtherCasted->TargetPrimitive;
 }
 
+void FALSXTRootMotionSource_ImpactReaction::CaptureImpactReactionState(const ACharacter& Character)
+{
+	const auto* Component{Character.FindComponentByClass<UALSXTImpactReactionComponent>()};
+
+	if (IsValid(Component))
+	{
+		ImpactReactionState = Component->GetImpactReactionState();
+	}
+	else if (Character.Implements<UALSXTCollisionInterface>())
+	{
+		ImpactReactionState = IALSXTCollisionInterface::Execute_GetImpactReactionState(const_cast<ACharacter*>(&Character));
+	}
+}
+
+void FALSXTRootMotionSource_ImpactReaction::BakeCurveTable()
+{
+	const auto& Montage{ImpactReactionState.ImpactReactionParameters.ImpactReactionAnimation.Montage};
+
+	const auto NewCurveTable{MakeShared<FALSXTRootMotionCurveTable>()};
+	NewCurveTable->Bake(Montage.BlendInCurve, Montage.InterpolationAndCorrectionAmountsCurve,
+	                    ImpactReactionSettings->CalculatePlayRate(Montage.ReferenceHeight, Montage.PlayRate, ImpactHeight),
+	                    ImpactReactionSettings->CalculateStartTime(Montage.ReferenceHeight, Montage.StartTime, ImpactHeight));
+
+	CurveTable = NewCurveTable;
+}
+
 void FALSXTRootMotionSource_ImpactReaction::PrepareRootMotion(const float SimulationDeltaTime, const float DeltaTime,
                                                       const ACharacter& Character, const UCharacterMovementComponent& Movement)
 {
-	const AALSXTCharacter& ALSXTCharacter = dynamic_cast<const AALSXTCharacter&>(Character);
-	AALSXTCharacter* ALSXTCharacterObject = Cast<AALSXTCharacter>(Character._getUObject());
-
-	if (UKismetSystemLibrary::DoesImplementInterface(ALSXTCharacterObject, UALSXTCollisionInterface::StaticClass()))
+	if (!CurveTable.IsValid())
 	{
-		ImpactReactionState = IALSXTCollisionInterface::Execute_GetImpactReactionState(ALSXTCharacterObject);
+		// Sources that were not fully initialized on creation (for example, received over the network)
+		// capture the impact reaction state from the character once instead of on every simulation step.
+
+		CaptureImpactReactionState(Character);
+		BakeCurveTable();
 	}
-	
+
 	SetTime(GetTime() + SimulationDeltaTime);
 
 	if (!ALS_ENSURE(Duration > SMALL_NUMBER) || DeltaTime <= SMALL_NUMBER)
@@ -53,7 +79,7 @@ void FALSXTRootMotionSource_ImpactReaction::PrepareRootMotion(const float Simula
 		return;
 	}
 
-	const auto ImpactTime{GetTime() * ImpactReactionSettings->CalculatePlayRate(ImpactReactionState.ImpactReactionParameters.ImpactReactionAnimation.Montage.ReferenceHeight, ImpactReactionState.ImpactReactionParameters.ImpactReactionAnimation.Montage.PlayRate, ImpactHeight)};
+	const auto ImpactTime{GetTime() * CurveTable->PlayRate};
 
 	// Calculate target transform from the stored relative transform to follow along with moving objects.
 
@@ -67,7 +93,7 @@ void FALSXTRootMotionSource_ImpactReaction::PrepareRootMotion(const float Simula
 	FVector LocationOffset;
 	FRotator RotationOffset;
 
-	const auto BlendInAmount{ImpactReactionState.ImpactReactionParameters.ImpactReactionAnimation.Montage.BlendInCurve->GetFloatValue(ImpactTime)};
+	const auto BlendInAmount{CurveTable->GetBlendInAmount(ImpactTime)};
 
 	if (!FAnimWeight::IsRelevant(BlendInAmount))
 	{
@@ -76,10 +102,7 @@ void FALSXTRootMotionSource_ImpactReaction::PrepareRootMotion(const float Simula
 	}
 	else
 	{
-		const FVector3f InterpolationAndCorrectionAmounts{
-			ImpactReactionState.ImpactReactionParameters.ImpactReactionAnimation.Montage.InterpolationAndCorrectionAmountsCurve->GetVectorValue(
-				ImpactTime + ImpactReactionSettings->CalculateStartTime(ImpactReactionState.ImpactReactionParameters.ImpactReactionAnimation.Montage.ReferenceHeight, ImpactReactionState.ImpactReactionParameters.ImpactReactionAnimation.Montage.StartTime, ImpactHeight))
-		};
+		const auto InterpolationAndCorrectionAmounts{CurveTable->GetInterpolationAndCorrectionAmounts(ImpactTime)};
 
 		const auto InterpolationAmount{InterpolationAndCorrectionAmounts.X};
 		const auto HorizontalCorrectionAmount{InterpolationAndCorrectionAmounts.Y};
@@ -165,6 +188,11 @@ bool FALSXTRootMotionSource_ImpactReaction::NetSerialize(FArchive& Archive, UPac
 
 	Archive << ImpactHeight;
 
+	if (Archive.IsLoading())
+	{
+		CurveTable.Reset();
+	}
+
 	return bSuccess;
 }
 
@@ -4,7 +4,6 @@
 #include "Curves/CurveFloat.h"
 #include "Curves/CurveVector.h"
 #include "GameFramework/Character.h"
-#include "ALSXTCharacter.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Settings/ALSXTVaultingSettings.h"
 #include "Utility/AlsMacros.h"
@@ -29,14 +28,29 @@ bool FALSXTRootMotionSource_Vaulting::Matches(const FRootMotionSource* Other) co
 	const auto* OtherCasted{static_cast<const FALSXTRootMotionSource_Vaulting*>(Other)};
 
 	return VaultingSettings == OtherCasted->VaultingSettings &&
+	       VaultAnimationIndex == OtherCasted->VaultAnimationIndex &&
 	       TargetPrimitive == OtherCasted->TargetPrimitive;
 }
 
+void FALSXTRootMotionSource_Vaulting::BakeCurveTable()
+{
+	const auto& Montage{VaultingState.VaultingParameters.VaultAnimation.Montage};
+
+	const auto NewCurveTable{MakeShared<FALSXTRootMotionCurveTable>()};
+	NewCurveTable->Bake(Montage.BlendInCurve, Montage.InterpolationAndCorrectionAmountsCurve,
+	                    VaultingSettings->GetPlayRateForHeight(Montage.ReferenceHeight, Montage.PlayRate, VaultingHeight),
+	                    VaultingSettings->GetStartTimeForHeight(Montage.ReferenceHeight, Montage.StartTime, VaultingHeight));
+
+	CurveTable = NewCurveTable;
+}
+
 void FALSXTRootMotionSource_Vaulting::PrepareRootMotion(const float SimulationDeltaTime, const float DeltaTime,
                                                       const ACharacter& Character, const UCharacterMovementComponent& Movement)
 {
-	const AALSXTCharacter& ALSXTCharacter = dynamic_cast<const AALSXTCharacter&>(Character);
-	VaultingState = ALSXTCharacter.GetVaultingState();
+	if (!CurveTable.IsValid())
+	{
+		BakeCurveTable();
+	}
 
 	SetTime(GetTime() + SimulationDeltaTime);
 
@@ -46,16 +60,7 @@ void FALSXTRootMotionSource_Vaulting::PrepareRootMotion(const float SimulationDe
 		return;
 	}
 
-	const auto VaultingTime{GetTime() * VaultingSettings->GetPlayRateForHeight(VaultingState.VaultingParameters.VaultAnimation.Montage.ReferenceHeight, VaultingState.VaultingParameters.VaultAnimation.Montage.PlayRate, VaultingHeight)};
-
-	// Calculate target transform from the stored relative transform to follow along with moving objects.
-
-	auto PlantingTargetTransform{
-		TargetPrimitive.IsValid()
-			? FTransform{TargetRelativeRotation, PlantingRelativeLocation, TargetPrimitive->GetComponentScale()}
-			.GetRelativeTransformReverse(TargetPrimitive->GetComponentTransform())
-			: FTransform{TargetRelativeRotation, PlantingRelativeLocation}
-	};
+	const auto VaultingTime{GetTime() * CurveTable->PlayRate};
 
 	// Calculate target transform from the stored relative transform to follow along with moving objects.
 
@@ -69,7 +74,7 @@ void FALSXTRootMotionSource_Vaulting::PrepareRootMotion(const float SimulationDe
 	FVector LocationOffset;
 	FRotator RotationOffset;
 
-	const auto BlendInAmount{ VaultingState.VaultingParameters.VaultAnimation.Montage.BlendInCurve->GetFloatValue(VaultingTime)};
+	const auto BlendInAmount{CurveTable->GetBlendInAmount(VaultingTime)};
 
 	if (!FAnimWeight::IsRelevant(BlendInAmount))
 	{
@@ -78,10 +83,7 @@ void FALSXTRootMotionSource_Vaulting::PrepareRootMotion(const float SimulationDe
 	}
 	else
 	{
-		const FVector3f InterpolationAndCorrectionAmounts{
-			VaultingState.VaultingParameters.VaultAnimation.Montage.InterpolationAndCorrectionAmountsCurve->GetVectorValue(
-				VaultingTime + VaultingSettings->GetStartTimeForHeight(VaultingState.VaultingParameters.VaultAnimation.Montage.ReferenceHeight, VaultingState.VaultingParameters.VaultAnimation.Montage.StartTime, VaultingHeight))
-		};
+		const auto InterpolationAndCorrectionAmounts{CurveTable->GetInterpolationAndCorrectionAmounts(VaultingTime)};
 
 		const auto InterpolationAmount{InterpolationAndCorrectionAmounts.X};
 		const auto HorizontalCorrectionAmount{InterpolationAndCorrectionAmounts.Y};
@@ -96,8 +98,8 @@ void FALSXTRootMotionSource_Vaulting::PrepareRootMotion(const float SimulationDe
 		{
 			// Calculate the animation offset. This would be the location the actual animation starts at relative to the target transform.
 
-			auto AnimationLocationOffset{TargetTransform.GetUnitAxis(EAxis::X) * VaultingState.VaultingParameters.TargetHandPlantRelativeLocation.X};
-			AnimationLocationOffset.Z = VaultingState.VaultingParameters.TargetHandPlantRelativeLocation.Z;
+			auto AnimationLocationOffset{TargetTransform.GetUnitAxis(EAxis::X) * PlantingRelativeLocation.X};
+			AnimationLocationOffset.Z = PlantingRelativeLocation.Z;
 			AnimationLocationOffset *= Character.GetMesh()->GetComponentScale().Z;
 
 			// Blend into the animation offset and final offset at the same time.
@@ -152,28 +154,32 @@ bool FALSXTRootMotionSource_Vaulting::NetSerialize(FArchive& Archive, UPackageMa
 
 	Archive << VaultingSettings;
 	Archive << TargetPrimitive;
-	Archive << VaultingState.VaultingParameters.VaultAnimation.Montage.Montage;
-	Archive << VaultingState.VaultingParameters.VaultAnimation.Montage.BlendInCurve;
-	Archive << VaultingState.VaultingParameters.VaultAnimation.Montage.InterpolationAndCorrectionAmountsCurve;
 
-	bSuccess &= SerializePackedVector<100, 30>(VaultingState.VaultingParameters.VaultAnimation.Montage.StartRelativeLocation, Archive);
+	// Only the index of the animation in the vaulting settings is sent, the montage, curves
+	// and reference values are immutable during the vault and are resolved from the settings.
 
-	VaultingState.VaultingParameters.VaultAnimation.Montage.StartRelativeLocation.NetSerialize(Archive, Map, bSuccessLocal);
-	VaultingState.VaultingParameters.VaultAnimation.Montage.StartRelativeLocation.Normalize();
-	bSuccess &= bSuccessLocal;
+	auto PackedVaultAnimationIndex{static_cast<uint32>(VaultAnimationIndex + 1)};
+	Archive.SerializeIntPacked(PackedVaultAnimationIndex);
 
-	VaultingState.VaultingParameters.VaultAnimation.Montage.ReferenceHeight.NetSerialize(Archive, Map, bSuccessLocal);
-	VaultingState.VaultingParameters.VaultAnimation.Montage.ReferenceHeight.Normalize();
-	bSuccess &= bSuccessLocal;
+	// Animations that are not in the vaulting settings, for example ones returned by a blueprint override
+	// of SelectVaultingMontage, can't be resolved from an index, so the montage is sent in full instead.
 
-	VaultingState.VaultingParameters.VaultAnimation.Montage.StartTime.NetSerialize(Archive, Map, bSuccessLocal);
-	VaultingState.VaultingParameters.VaultAnimation.Montage.StartTime.Normalize();
-	bSuccess &= bSuccessLocal;
+	if (PackedVaultAnimationIndex == 0)
+	{
+		auto& Montage{VaultingState.VaultingParameters.VaultAnimation.Montage};
 
-	VaultingState.VaultingParameters.VaultAnimation.Montage.PlayRate.NetSerialize(Archive, Map, bSuccessLocal);
-	VaultingState.VaultingParameters.VaultAnimation.Montage.PlayRate.Normalize();
-	bSuccess &= bSuccessLocal;
+		Archive << Montage.Montage;
+		Archive << Montage.BlendInCurve;
+		Archive << Montage.InterpolationAndCorrectionAmountsCurve;
+
+		bSuccess &= SerializePackedVector<100, 30>(Montage.StartRelativeLocation, Archive);
 
+		Archive << Montage.ReferenceHeight;
+		Archive << Montage.StartTime;
+		Archive << Montage.PlayRate;
+	}
+
+	bSuccess &= SerializePackedVector<100, 30>(PlantingRelativeLocation, Archive);
 	bSuccess &= SerializePackedVector<100, 30>(TargetRelativeLocation, Archive);
 
 	TargetRelativeRotation.NetSerialize(Archive, Map, bSuccessLocal);
@@ -188,9 +194,30 @@ bool FALSXTRootMotionSource_Vaulting::NetSerialize(FArchive& Archive, UPackageMa
 
 	Archive << VaultingHeight;
 
+	if (Archive.IsLoading())
+	{
+		VaultAnimationIndex = static_cast<int32>(PackedVaultAnimationIndex) - 1;
+		ResolveVaultAnimation();
+
+		CurveTable.Reset();
+	}
+
 	return bSuccess;
 }
 
+void FALSXTRootMotionSource_Vaulting::ResolveVaultAnimation()
+{
+	if (VaultAnimationIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (ALS_ENSURE(IsValid(VaultingSettings) && VaultingSettings->VaultAnimations.IsValidIndex(VaultAnimationIndex)))
+	{
+		VaultingState.VaultingParameters.VaultAnimation = VaultingSettings->VaultAnimations[VaultAnimationIndex];
+	}
+}
+
 UScriptStruct* FALSXTRootMotionSource_Vaulting::GetScriptStruct() const
 {
 	return StaticStruct();
@@ -0,0 +1,88 @@
+#include "Settings/ALSXTCombatSettings.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTCombatSettings)
+
+namespace ALSXTCombatSettings
+{
+	const TArray<int32> EmptyIndices;
+
+	// Adds the index of each animation to the key of every combination of its attack types, stances and strengths.
+
+	template <typename AnimationType, typename ProjectionType>
+	void BuildAnimationIndices(const TArray<AnimationType>& Animations, ProjectionType Projection,
+	                           TMap<FALSXTAttackAnimationKey, TArray<int32>>& Indices)
+	{
+		Indices.Reset();
+
+		for (auto i{0}; i < Animations.Num(); i++)
+		{
+			const FGameplayTagContainer* AttackTypes;
+			const FGameplayTagContainer* Stances;
+			const FGameplayTagContainer* Strengths;
+			Projection(Animations[i], AttackTypes, Stances, Strengths);
+
+			for (const auto& AttackType : *AttackTypes)
+			{
+				for (const auto& Stance : *Stances)
+				{
+					for (const auto& Strength : *Strengths)
+					{
+						Indices.FindOrAdd({AttackType, Stance, Strength}).AddUnique(i);
+					}
+				}
+			}
+		}
+
+		Indices.Shrink();
+	}
+}
+
+void UALSXTCombatSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildAnimationIndices();
+}
+
+#if WITH_EDITOR
+void UALSXTCombatSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	RebuildAnimationIndices();
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UALSXTCombatSettings::RebuildAnimationIndices()
+{
+	ALSXTCombatSettings::BuildAnimationIndices(AttackAnimations, [](const FAttackAnimation& Animation, const FGameplayTagContainer*& AttackTypes,
+	                                                                const FGameplayTagContainer*& Stances,
+	                                                                const FGameplayTagContainer*& Strengths)
+	{
+		AttackTypes = &Animation.AttackType;
+		Stances = &Animation.AttackStances;
+		Strengths = &Animation.AttackStrengths;
+	}, AttackAnimationIndices);
+
+	ALSXTCombatSettings::BuildAnimationIndices(SyncedAttackAnimations, [](const FSyncedAttackAnimation& Animation,
+	                                                                      const FGameplayTagContainer*& AttackTypes,
+	                                                                      const FGameplayTagContainer*& Stances,
+	                                                                      const FGameplayTagContainer*& Strengths)
+	{
+		AttackTypes = &Animation.AttackType;
+		Stances = &Animation.AttackStance;
+		Strengths = &Animation.AttackStrength;
+	}, SyncedAttackAnimationIndices);
+}
+
+const TArray<int32>& UALSXTCombatSettings::GetAttackAnimationIndices(const FALSXTAttackAnimationKey& Key) const
+{
+	const auto* Indices{AttackAnimationIndices.Find(Key)};
+	return Indices != nullptr ? *Indices : ALSXTCombatSettings::EmptyIndices;
+}
+
+const TArray<int32>& UALSXTCombatSettings::GetSyncedAttackAnimationIndices(const FALSXTAttackAnimationKey& Key) const
+{
+	const auto* Indices{SyncedAttackAnimationIndices.Find(Key)};
+	return Indices != nullptr ? *Indices : ALSXTCombatSettings::EmptyIndices;
+}
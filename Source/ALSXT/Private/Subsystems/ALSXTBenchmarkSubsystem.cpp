@@ -0,0 +1,399 @@
+#include "Subsystems/ALSXTBenchmarkSubsystem.h"
+
+#include "ALSXTCharacter.h"
+#include "EngineUtils.h"
+#include "Algo/Accumulate.h"
+#include "Components/Character/ALSXTCombatComponent.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Subsystems/ALSXTEffectCommandSubsystem.h"
+#include "Subsystems/ALSXTEffectSpawnSubsystem.h"
+#include "Utility/ALSXTEnums.h"
+#include "Utility/ALSXTGameplayTags.h"
+#include "Utility/ALSXTNetAccounting.h"
+#include "Utility/ALSXTStats.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTBenchmarkSubsystem)
+
+bool UALSXTBenchmarkSubsystem::IsBenchmarkEnabled()
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("ALSXTBenchmark"));
+}
+
+bool UALSXTBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer) || !IsBenchmarkEnabled())
+	{
+		return false;
+	}
+
+	const auto* World{Cast<UWorld>(Outer)};
+	return IsValid(World) && World->IsGameWorld();
+}
+
+void UALSXTBenchmarkSubsystem::OnWorldBeginPlay(UWorld& World)
+{
+	Super::OnWorldBeginPlay(World);
+
+	// Only the server drives the characters, clients connected to a
+	// listen server benchmark run just replicate them.
+
+	if (World.GetNetMode() == NM_Client)
+	{
+		bFinished = true;
+		return;
+	}
+
+	FParse::Value(FCommandLine::Get(), TEXT("ALSXTBenchmarkCharacters="), CharacterCount);
+	FParse::Value(FCommandLine::Get(), TEXT("ALSXTBenchmarkDuration="), Duration);
+
+	CharacterCount = FMath::Clamp(CharacterCount, 1, MaxCharacters);
+	Duration = FMath::Max(Duration, static_cast<double>(PhaseDuration));
+
+	SpawnCharacters(World);
+
+	if (Characters.Num() <= 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ALSXT benchmark: no character could be spawned."));
+
+		bFinished = true;
+		ExitBenchmark(FailedExitStatus);
+		return;
+	}
+
+	ALSXTStats::bBenchmarkCountersEnabled = true;
+
+	// Only account the traffic of the measured run, not of the level loading and spawning.
+
+	ALSXTNetAccounting::ResetReport();
+
+	StartTime = World.GetTimeSeconds();
+	Samples.Reserve(FMath::CeilToInt32(Duration * 120.0));
+	BenchmarkCounterValues.Reserve(Samples.Max() * ALSXTStats::GetBenchmarkCounters().Num());
+}
+
+TStatId UALSXTBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UALSXTBenchmarkSubsystem, STATGROUP_Tickables)
+}
+
+void UALSXTBenchmarkSubsystem::Tick(const float DeltaTime)
+{
+	if (bFinished || Characters.Num() <= 0)
+	{
+		return;
+	}
+
+	const auto Time{GetWorld()->GetTimeSeconds()};
+
+	for (auto i{0}; i < Characters.Num(); i++)
+	{
+		auto* Character{Characters[i].Get()};
+		if (IsValid(Character))
+		{
+			DriveCharacter(*Character, i, Time);
+		}
+	}
+
+	RecordSample(DeltaTime);
+
+	if (Time - StartTime >= Duration)
+	{
+		FinishBenchmark();
+	}
+}
+
+void UALSXTBenchmarkSubsystem::SpawnCharacters(UWorld& World)
+{
+	FString CharacterClassPath;
+	FParse::Value(FCommandLine::Get(), TEXT("ALSXTBenchmarkCharacterClass="), CharacterClassPath);
+
+	UClass* CharacterClass{AALSXTCharacter::StaticClass()};
+	if (!CharacterClassPath.IsEmpty())
+	{
+		auto* LoadedClass{LoadClass<AALSXTCharacter>(nullptr, *CharacterClassPath)};
+		if (IsValid(LoadedClass))
+		{
+			CharacterClass = LoadedClass;
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ALSXT benchmark: failed to load character class %s, using the native class."),
+			       *CharacterClassPath);
+		}
+	}
+
+	for (TActorIterator<APlayerStart> Iterator{&World}; Iterator; ++Iterator)
+	{
+		CourseCenter = Iterator->GetActorLocation();
+		break;
+	}
+
+	CourseRadius = FMath::Max(MinCourseRadius, CharacterCount * CharacterSpacing / UE_TWO_PI);
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	Characters.Reserve(CharacterCount);
+	CharacterPhases.Init(EBenchmarkPhase::Count, CharacterCount);
+
+	for (auto i{0}; i < CharacterCount; i++)
+	{
+		const auto Angle{UE_TWO_PI * i / CharacterCount};
+		const FVector Location{CourseCenter + FVector{FMath::Cos(Angle), FMath::Sin(Angle), 0.0f} * CourseRadius};
+
+		auto* Character{World.SpawnActor<AALSXTCharacter>(CharacterClass, Location, FRotator::ZeroRotator, SpawnParameters)};
+		if (!IsValid(Character))
+		{
+			continue;
+		}
+
+		// Movement input is only consumed by controlled characters.
+
+		if (!IsValid(Character->GetController()))
+		{
+			Character->SpawnDefaultController();
+		}
+
+		Characters.Add(Character);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ALSXT benchmark: spawned %d of %d characters of class %s for %.0f seconds."),
+	       Characters.Num(), CharacterCount, *CharacterClass->GetName(), Duration);
+}
+
+void UALSXTBenchmarkSubsystem::DriveCharacter(AALSXTCharacter& Character, const int32 CharacterIndex, const double Time)
+{
+	// Phases are staggered by character index, so that every phase is running at any point of the run.
+
+	static constexpr auto PhaseCount{static_cast<int32>(EBenchmarkPhase::Count)};
+
+	const auto Phase{
+		static_cast<EBenchmarkPhase>((FMath::FloorToInt32((Time - StartTime) / PhaseDuration) + CharacterIndex) % PhaseCount)
+	};
+
+	const auto bPhaseChanged{CharacterPhases[CharacterIndex] != Phase};
+	CharacterPhases[CharacterIndex] = Phase;
+
+	switch (Phase)
+	{
+	case EBenchmarkPhase::Idle:
+		if (bPhaseChanged)
+		{
+			Character.SetDesiredCombatStance(ALSXTCombatStanceTags::Neutral);
+		}
+		return;
+
+	case EBenchmarkPhase::Walk:
+		if (bPhaseChanged)
+		{
+			Character.SetDesiredGait(AlsGaitTags::Walking);
+		}
+		break;
+
+	case EBenchmarkPhase::Sprint:
+		if (bPhaseChanged)
+		{
+			Character.SetDesiredGait(AlsGaitTags::Sprinting);
+		}
+		break;
+
+	case EBenchmarkPhase::Slide:
+		if (bPhaseChanged)
+		{
+			Character.SetDesiredGait(AlsGaitTags::Running);
+			Character.TryStartSliding();
+		}
+		break;
+
+	case EBenchmarkPhase::Vault:
+		// Vaults over course obstacles when there are any in front of the character, jumps otherwise.
+		if (bPhaseChanged && !Character.TryStartVaultingGrounded())
+		{
+			Character.Jump();
+		}
+		break;
+
+	case EBenchmarkPhase::Attack:
+		if (bPhaseChanged)
+		{
+			Character.SetDesiredCombatStance(ALSXTCombatStanceTags::Ready);
+		}
+		else
+		{
+			auto* Combat{Character.FindComponentByClass<UALSXTCombatComponent>()};
+			if (IsValid(Combat))
+			{
+				Combat->InputPrimaryAction();
+			}
+		}
+		return;
+
+	default:
+		return;
+	}
+
+	// Follow the ring course counterclockwise, steering back onto it when pushed away by other characters.
+
+	const auto Offset{(Character.GetActorLocation() - CourseCenter) * FVector{1.0f, 1.0f, 0.0f}};
+	const auto Distance{Offset.Size()};
+	if (Distance <= UE_KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	const auto RadialDirection{Offset / Distance};
+	const FVector TangentDirection{-RadialDirection.Y, RadialDirection.X, 0.0f};
+
+	Character.AddMovementInput(TangentDirection + RadialDirection * ((CourseRadius - Distance) / CourseRadius));
+}
+
+void UALSXTBenchmarkSubsystem::RecordSample(const float DeltaTime)
+{
+	const auto* World{GetWorld()};
+
+	auto& Sample{Samples.AddDefaulted_GetRef()};
+	Sample.Time = World->GetTimeSeconds() - StartTime;
+	Sample.DeltaTime = DeltaTime;
+	Sample.UsedPhysicalMemory = FPlatformMemory::GetStats().UsedPhysical;
+
+	const auto* EffectSpawnSubsystem{World->GetSubsystem<UALSXTEffectSpawnSubsystem>()};
+	if (IsValid(EffectSpawnSubsystem))
+	{
+		for (auto Type : TEnumRange<EALSXTEffectSpawnType>())
+		{
+			Sample.SpawnedEffectCount += EffectSpawnSubsystem->GetSpawnedEffectCount(Type);
+			Sample.CulledEffectCount += EffectSpawnSubsystem->GetCulledEffectCount(Type);
+		}
+	}
+
+	const auto* EffectCommandSubsystem{World->GetSubsystem<UALSXTEffectCommandSubsystem>()};
+	if (IsValid(EffectCommandSubsystem))
+	{
+		Sample.ExecutedCommandCount = EffectCommandSubsystem->GetExecutedCommandCount();
+		Sample.DroppedCommandCount = EffectCommandSubsystem->GetDroppedCommandCount();
+	}
+
+	const auto* NetDriver{World->GetNetDriver()};
+	if (IsValid(NetDriver))
+	{
+		Sample.ReplicatedBytes = NetDriver->OutTotalBytes;
+	}
+
+	Sample.BenchmarkCounterIndex = BenchmarkCounterValues.Num();
+
+	for (const auto* Counter : ALSXTStats::GetBenchmarkCounters())
+	{
+		BenchmarkCounterValues.Add(Counter->GetValue());
+	}
+}
+
+void UALSXTBenchmarkSubsystem::FinishBenchmark()
+{
+	bFinished = true;
+	ALSXTStats::bBenchmarkCountersEnabled = false;
+
+	const auto& Counters{ALSXTStats::GetBenchmarkCounters()};
+
+	// Cycle counters are written in milliseconds.
+
+	FString Csv{TEXT("Time,DeltaTime,UsedPhysicalMemory,SpawnedEffects,CulledEffects,ExecutedCommands,DroppedCommands,ReplicatedBytes")};
+
+	for (const auto* Counter : Counters)
+	{
+		Csv += FString::Printf(TEXT(",%s%s"), Counter->GetName(), Counter->IsCycles() ? TEXT("Ms") : TEXT(""));
+	}
+
+	Csv += TEXT('\n');
+
+	TArray<float> DeltaTimes;
+	DeltaTimes.Reserve(Samples.Num());
+
+	for (const auto& Sample : Samples)
+	{
+		Csv += FString::Printf(TEXT("%.4f,%.6f,%llu,%u,%u,%u,%u,%u"), Sample.Time, Sample.DeltaTime, Sample.UsedPhysicalMemory,
+		                       Sample.SpawnedEffectCount, Sample.CulledEffectCount, Sample.ExecutedCommandCount,
+		                       Sample.DroppedCommandCount, Sample.ReplicatedBytes);
+
+		for (auto i{0}; i < Counters.Num(); i++)
+		{
+			const auto Value{BenchmarkCounterValues[Sample.BenchmarkCounterIndex + i]};
+
+			Csv += Counters[i]->IsCycles()
+				       ? FString::Printf(TEXT(",%.4f"), FPlatformTime::ToMilliseconds64(Value))
+				       : FString::Printf(TEXT(",%llu"), Value);
+		}
+
+		Csv += TEXT('\n');
+
+		DeltaTimes.Add(Sample.DeltaTime);
+	}
+
+	const auto FilePath{
+		FPaths::ProfilingDir() / TEXT("ALSXT") / FString::Printf(TEXT("Benchmark-%d-%s.csv"), CharacterCount,
+		                                                         *FDateTime::Now().ToString())
+	};
+
+	const auto bSaved{FFileHelper::SaveStringToFile(Csv, *FilePath)};
+
+	if (bSaved)
+	{
+		DeltaTimes.Sort();
+
+		const auto AverageDeltaTime{
+			DeltaTimes.Num() > 0 ? Algo::Accumulate(DeltaTimes, 0.0) / DeltaTimes.Num() : 0.0
+		};
+
+		const auto PercentileDeltaTime{
+			DeltaTimes.Num() > 0 ? DeltaTimes[FMath::Min(FMath::FloorToInt32(DeltaTimes.Num() * 0.99f), DeltaTimes.Num() - 1)] : 0.0f
+		};
+
+		UE_LOG(LogTemp, Log, TEXT("ALSXT benchmark: %d characters, %d frames, average frame %.2f ms, 99th percentile frame %.2f ms,")
+		       TEXT(" written to %s."), Characters.Num(), Samples.Num(), AverageDeltaTime * 1000.0,
+		       PercentileDeltaTime * 1000.0f, *FilePath);
+
+		const auto FrameCount{FMath::Max(Samples.Num(), 1)};
+
+		for (const auto* Counter : Counters)
+		{
+			if (Counter->IsCycles())
+			{
+				UE_LOG(LogTemp, Log, TEXT("ALSXT benchmark: %s %.3f ms per frame."), Counter->GetName(),
+				       FPlatformTime::ToMilliseconds64(Counter->GetValue()) / FrameCount);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Log, TEXT("ALSXT benchmark: %s %.1f per frame."), Counter->GetName(),
+				       static_cast<double>(Counter->GetValue()) / FrameCount);
+			}
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("ALSXT benchmark: failed to write %s."), *FilePath);
+	}
+
+	Samples.Empty();
+	BenchmarkCounterValues.Empty();
+
+	const auto bWithinNetBudget{!ALSXTNetAccounting::IsEnabled() || ALSXTNetAccounting::DumpReport()};
+
+	ExitBenchmark(!bSaved ? FailedExitStatus : !bWithinNetBudget ? OverNetBudgetExitStatus : 0);
+}
+
+void UALSXTBenchmarkSubsystem::ExitBenchmark(const uint8 ExitStatus)
+{
+	if (ExitStatus == 0)
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+	else
+	{
+		FPlatformMisc::RequestExitWithStatus(false, ExitStatus);
+	}
+}
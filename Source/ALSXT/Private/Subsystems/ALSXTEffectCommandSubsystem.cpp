@@ -0,0 +1,123 @@
+#include "Subsystems/ALSXTEffectCommandSubsystem.h"
+
+#include "Algo/StableSort.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "Notify/ALSXTAnimNotify_CharacterBreathEffects.h"
+#include "Notify/ALSXTAnimNotify_CharacterMovementSound.h"
+#include "Notify/ALSXTAnimNotify_FootstepEffects.h"
+#include "Notify/ALSXTAnimNotify_SlideEffects.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTEffectCommandSubsystem)
+
+bool UALSXTEffectCommandSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const auto* World{Cast<UWorld>(Outer)};
+	return IsValid(World) && World->IsGameWorld();
+}
+
+TStatId UALSXTEffectCommandSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UALSXTEffectCommandSubsystem, STATGROUP_Tickables)
+}
+
+void UALSXTEffectCommandSubsystem::Tick(const float DeltaTime)
+{
+	if (Commands.Num() <= 0)
+	{
+		return;
+	}
+
+	// Move the commands out first, so that effects requested while executing are kept for the next frame.
+
+	Swap(Commands, ExecutingCommands);
+
+	// The sort is stable, so that commands of the same type keep the order they were recorded in.
+
+	Algo::StableSortBy(ExecutingCommands, &FEffectCommand::Type);
+
+	auto ExecutedCount{0};
+
+	for (const auto& Command : ExecutingCommands)
+	{
+		if (ExecutedCount < MaxCommandsPerFrame)
+		{
+			ExecuteCommand(Command);
+			ExecutedCount += 1;
+		}
+		else if (GFrameCounter - Command.Frame < MaxCommandAge)
+		{
+			Commands.Add(Command);
+		}
+		else
+		{
+			DroppedCommandCount += 1;
+		}
+	}
+
+	ExecutedCommandCount += ExecutedCount;
+	ExecutingCommands.Reset();
+}
+
+void UALSXTEffectCommandSubsystem::RecordCommand(const EALSXTEffectCommandType Type, const uint8 Variant,
+                                                 UAnimNotify* Notify, USkeletalMeshComponent* Mesh)
+{
+	// The same notify often fires more than once for the same foot in the same frame, only one is kept. Different
+	// notifies may have different settings, so they are never merged with each other.
+
+	const auto bMerged{
+		Commands.ContainsByPredicate([Type, Variant, Notify, Mesh](const FEffectCommand& Command)
+		{
+			return Command.Frame == GFrameCounter && Command.Type == Type && Command.Variant == Variant &&
+			       Command.Notify == Notify && Command.Mesh == Mesh;
+		})
+	};
+
+	if (bMerged)
+	{
+		MergedCommandCount += 1;
+		return;
+	}
+
+	auto& Command{Commands.AddDefaulted_GetRef()};
+	Command.Notify = Notify;
+	Command.Mesh = Mesh;
+	Command.Frame = GFrameCounter;
+	Command.Type = Type;
+	Command.Variant = Variant;
+}
+
+void UALSXTEffectCommandSubsystem::ExecuteCommand(const FEffectCommand& Command)
+{
+	auto* Notify{Command.Notify.Get()};
+	auto* Mesh{Command.Mesh.Get()};
+
+	if (!IsValid(Notify) || !IsValid(Mesh))
+	{
+		return;
+	}
+
+	switch (Command.Type)
+	{
+	case EALSXTEffectCommandType::Footstep:
+		static_cast<UALSXTAnimNotify_FootstepEffects*>(Notify)->SpawnEffects(Mesh);
+		break;
+
+	case EALSXTEffectCommandType::Slide:
+		static_cast<UALSXTAnimNotify_SlideEffects*>(Notify)->SpawnEffects(Mesh);
+		break;
+
+	case EALSXTEffectCommandType::CharacterBreath:
+		static_cast<UALSXTAnimNotify_CharacterBreathEffects*>(Notify)->SpawnEffects(Mesh);
+		break;
+
+	case EALSXTEffectCommandType::CharacterMovementSound:
+		static_cast<UALSXTAnimNotify_CharacterMovementSound*>(Notify)->SpawnEffects(Mesh);
+		break;
+	}
+}
@@ -0,0 +1,184 @@
+#include "Subsystems/ALSXTEffectSpawnSubsystem.h"
+
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Utility/ALSXTStats.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTEffectSpawnSubsystem)
+
+namespace ALSXTEffectSpawnSubsystem
+{
+	// How long a source component is considered recently rendered.
+	static constexpr auto RecentlyRenderedTolerance{0.2f};
+}
+
+bool UALSXTEffectSpawnSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const auto* World{Cast<UWorld>(Outer)};
+	return IsValid(World) && (World->IsGameWorld() || World->WorldType == EWorldType::EditorPreview);
+}
+
+void UALSXTEffectSpawnSubsystem::Deinitialize()
+{
+	for (auto& Effects : ActiveEffects)
+	{
+		Effects.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+const FALSXTEffectSpawnTypeSettings& UALSXTEffectSpawnSubsystem::GetEffectTypeSettings(const EALSXTEffectSpawnType Type) const
+{
+	switch (Type)
+	{
+	case EALSXTEffectSpawnType::Slide:
+		return SlideEffectSettings;
+
+	case EALSXTEffectSpawnType::Breath:
+		return BreathEffectSettings;
+
+	default:
+		return FootstepEffectSettings;
+	}
+}
+
+UNiagaraComponent* UALSXTEffectSpawnSubsystem::SpawnSystemAtLocation(const EALSXTEffectSpawnType Type, UNiagaraSystem* System,
+                                                                     const FVector& Location, const FRotator& Rotation,
+                                                                     const FVector& Scale, const UPrimitiveComponent* SourceComponent)
+{
+	if (!ShouldSpawnEffect(Type, System, Location, SourceComponent))
+	{
+		return nullptr;
+	}
+
+	auto* Component{
+		UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), System, Location, Rotation, Scale,
+		                                               true, true, ENCPoolMethod::AutoRelease)
+	};
+
+	AddActiveEffect(Type, Component);
+	return Component;
+}
+
+UNiagaraComponent* UALSXTEffectSpawnSubsystem::SpawnSystemAttached(const EALSXTEffectSpawnType Type, UNiagaraSystem* System,
+                                                                   USceneComponent* AttachComponent, const FName AttachPointName,
+                                                                   const FVector& Location, const FRotator& Rotation,
+                                                                   const FVector& Scale, const EAttachLocation::Type LocationType)
+{
+	if (!IsValid(AttachComponent))
+	{
+		return nullptr;
+	}
+
+	const auto WorldLocation{
+		LocationType == EAttachLocation::KeepWorldPosition ? Location : AttachComponent->GetSocketLocation(AttachPointName)
+	};
+
+	if (!ShouldSpawnEffect(Type, System, WorldLocation, Cast<UPrimitiveComponent>(AttachComponent)))
+	{
+		return nullptr;
+	}
+
+	auto* Component{
+		UNiagaraFunctionLibrary::SpawnSystemAttached(System, AttachComponent, AttachPointName, Location, Rotation, Scale,
+		                                             LocationType, true, ENCPoolMethod::AutoRelease)
+	};
+
+	AddActiveEffect(Type, Component);
+	return Component;
+}
+
+bool UALSXTEffectSpawnSubsystem::ShouldSpawnEffect(const EALSXTEffectSpawnType Type, const UNiagaraSystem* System,
+                                                   const FVector& Location, const UPrimitiveComponent* SourceComponent)
+{
+	if (!IsValid(System))
+	{
+		return false;
+	}
+
+	const auto TypeIndex{static_cast<uint8>(Type)};
+	const auto& Settings{GetEffectTypeSettings(Type)};
+	const auto* World{GetWorld()};
+
+	// Animation previews have no views and always spawn their effects.
+
+	if (World->WorldType != EWorldType::EditorPreview)
+	{
+		RefreshViewLocations();
+
+		auto ClosestViewDistanceSquared{TNumericLimits<double>::Max()};
+
+		for (const auto& ViewLocation : ViewLocations)
+		{
+			ClosestViewDistanceSquared = FMath::Min(ClosestViewDistanceSquared, FVector::DistSquared(ViewLocation, Location));
+		}
+
+		if (ClosestViewDistanceSquared > FMath::Square(Settings.CullDistance) ||
+		    (ClosestViewDistanceSquared > FMath::Square(Settings.SignificanceDistance) &&
+		     IsValid(SourceComponent) && !SourceComponent->WasRecentlyRendered(ALSXTEffectSpawnSubsystem::RecentlyRenderedTolerance)))
+		{
+			CulledEffectCounts[TypeIndex] += 1;
+			return false;
+		}
+	}
+
+	auto& Effects{ActiveEffects[TypeIndex]};
+
+	Effects.RemoveAllSwap([](const FActiveEffect& Effect)
+	{
+		const auto* Component{Effect.Component.Get()};
+		return !IsValid(Component) || !Component->IsActive() || Component->GetAsset() != Effect.System.ResolveObjectPtr();
+	});
+
+	if (Effects.Num() >= Settings.MaxInstances)
+	{
+		CulledEffectCounts[TypeIndex] += 1;
+		return false;
+	}
+
+	return true;
+}
+
+void UALSXTEffectSpawnSubsystem::RefreshViewLocations()
+{
+	if (ViewLocationsFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	ViewLocationsFrame = GFrameCounter;
+	ViewLocations.Reset();
+
+	// Dedicated servers have no local views, so every effect is culled there.
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* PlayerController{Iterator->Get()};
+
+		if (IsValid(PlayerController) && PlayerController->IsLocalController() && IsValid(PlayerController->PlayerCameraManager))
+		{
+			ViewLocations.Add(PlayerController->PlayerCameraManager->GetCameraLocation());
+		}
+	}
+}
+
+void UALSXTEffectSpawnSubsystem::AddActiveEffect(const EALSXTEffectSpawnType Type, UNiagaraComponent* Component)
+{
+	if (IsValid(Component))
+	{
+		ActiveEffects[static_cast<uint8>(Type)].Add({Component, Component->GetAsset()});
+		SpawnedEffectCounts[static_cast<uint8>(Type)] += 1;
+
+		ALSXT_INC_DWORD_STAT(STAT_ALSXT_EffectsSpawned);
+	}
+}
@@ -0,0 +1,346 @@
+#include "Subsystems/ALSXTFootstepEffectsSubsystem.h"
+
+#include "ALSXTCharacter.h"
+#include "DrawDebugHelpers.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/DecalComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/WorldSettings.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Notify/ALSXTAnimNotify_FootstepEffects.h"
+#include "Notify/ALSXTAnimNotify_SlideEffects.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "UObject/UObjectIterator.h"
+#include "Utility/AlsConstants.h"
+#include "Utility/AlsUtility.h"
+#include "Utility/ALSXTStats.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTFootstepEffectsSubsystem)
+
+namespace ALSXTFootstepEffectsSubsystem
+{
+	// The floor may deviate this much from the plane of the cached surface, e.g. on stairs of a single mesh.
+	static constexpr auto MaxFloorPlaneDistance{2.0f};
+
+	// Intersects the surface trace with the plane of the cached surface. Fails if the character no longer stands
+	// on the cached floor plane, or the footstep is too far from the previous footstep of the foot.
+	bool TryGetCachedSurfaceHit(const FALSXTFootstepSurfaceCache& Cache, const ACharacter& Character, const FVector& TraceStart,
+	                            const FVector& TraceEnd, const float CacheDistance, FHitResult& Hit)
+	{
+		if (!Cache.bValid || CacheDistance <= 0.0f || !Cache.Component.IsValid())
+		{
+			return false;
+		}
+
+		const auto& Floor{Character.GetCharacterMovement()->CurrentFloor};
+
+		if (!Floor.bBlockingHit || Floor.HitResult.GetComponent() != Cache.Component.Get() ||
+		    (Floor.HitResult.ImpactNormal | Cache.ImpactNormal) < 0.999f ||
+		    FMath::Abs((Floor.HitResult.ImpactPoint - Cache.ImpactPoint) | Cache.ImpactNormal) > MaxFloorPlaneDistance)
+		{
+			return false;
+		}
+
+		const auto TraceDirection{TraceEnd - TraceStart};
+		const auto DirectionDotNormal{TraceDirection | Cache.ImpactNormal};
+
+		if (DirectionDotNormal > -UE_KINDA_SMALL_NUMBER)
+		{
+			return false;
+		}
+
+		const auto Time{((Cache.ImpactPoint - TraceStart) | Cache.ImpactNormal) / DirectionDotNormal};
+		if (Time < 0.0f || Time > 1.0f)
+		{
+			return false;
+		}
+
+		const auto ImpactPoint{TraceStart + TraceDirection * Time};
+		if (FVector::DistSquared(ImpactPoint, Cache.ImpactPoint) > FMath::Square(CacheDistance))
+		{
+			return false;
+		}
+
+		Hit = FHitResult{Cache.Component->GetOwner(), Cache.Component.Get(), ImpactPoint, Cache.ImpactNormal};
+		Hit.TraceStart = TraceStart;
+		Hit.TraceEnd = TraceEnd;
+		Hit.Time = UE_REAL_TO_FLOAT(Time);
+		Hit.Distance = UE_REAL_TO_FLOAT(TraceDirection.Size() * Time);
+		Hit.PhysMaterial = Cache.PhysicalMaterial;
+
+		return true;
+	}
+}
+
+bool UALSXTFootstepEffectsSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const auto* World{Cast<UWorld>(Outer)};
+	return IsValid(World) && (World->IsGameWorld() || World->WorldType == EWorldType::EditorPreview);
+}
+
+void UALSXTFootstepEffectsSubsystem::OnWorldBeginPlay(UWorld& World)
+{
+	Super::OnWorldBeginPlay(World);
+
+	// The settings referenced by the animations of the level are already loaded at this point.
+
+	for (TObjectIterator<UALSXTFootstepEffectsSettings> Iterator; Iterator; ++Iterator)
+	{
+		if (!Iterator->HasAnyFlags(RF_ClassDefaultObject))
+		{
+			PreloadEffectsSettings(*Iterator);
+		}
+	}
+
+	for (TObjectIterator<UALSXTSlideEffectsSettings> Iterator; Iterator; ++Iterator)
+	{
+		if (!Iterator->HasAnyFlags(RF_ClassDefaultObject))
+		{
+			PreloadEffectsSettings(*Iterator);
+		}
+	}
+}
+
+void UALSXTFootstepEffectsSubsystem::Deinitialize()
+{
+	for (auto& Pair : PreloadHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->ReleaseHandle();
+		}
+	}
+
+	PreloadHandles.Reset();
+
+	for (const auto& PooledDecal : FootprintDecals)
+	{
+		if (IsValid(PooledDecal.Decal))
+		{
+			PooledDecal.Decal->DestroyComponent();
+		}
+	}
+
+	FootprintDecals.Reset();
+	NextFootprintDecalIndex = 0;
+
+	Super::Deinitialize();
+}
+
+void UALSXTFootstepEffectsSubsystem::PreloadEffectsSettings(const UALSXTFootstepEffectsSettings* Settings)
+{
+	if (IsValid(Settings) && !PreloadHandles.Contains(Settings))
+	{
+		TArray<FSoftObjectPath> AssetPaths;
+		Settings->GetEffectAssetPaths(AssetPaths);
+
+		PreloadEffectAssets(Settings, MoveTemp(AssetPaths));
+	}
+}
+
+void UALSXTFootstepEffectsSubsystem::PreloadEffectsSettings(const UALSXTSlideEffectsSettings* Settings)
+{
+	if (IsValid(Settings) && !PreloadHandles.Contains(Settings))
+	{
+		TArray<FSoftObjectPath> AssetPaths;
+		Settings->GetEffectAssetPaths(AssetPaths);
+
+		PreloadEffectAssets(Settings, MoveTemp(AssetPaths));
+	}
+}
+
+void UALSXTFootstepEffectsSubsystem::PreloadEffectAssets(const UObject* Settings, TArray<FSoftObjectPath>&& AssetPaths)
+{
+	auto& Handle{PreloadHandles.Add(Settings)};
+
+	if (AssetPaths.Num() > 0)
+	{
+		Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths), FStreamableDelegate{},
+		                                                                FStreamableManager::AsyncLoadHighPriority);
+	}
+}
+
+void UALSXTFootstepEffectsSubsystem::ResolveSurface(const USkeletalMeshComponent& Mesh, const EALSXTFootBone FootBone,
+                                                    const FALSXTSurfaceTraceSettings& TraceSettings, FALSXTResolvedSurface& Surface) const
+{
+	auto* Character{Cast<AALSXTCharacter>(Mesh.GetOwner())};
+	const auto* World{Mesh.GetWorld()};
+
+	Surface.FootBoneName = FootBone == EALSXTFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName();
+	Surface.FootTransform = Mesh.GetSocketTransform(Surface.FootBoneName);
+	Surface.CapsuleScale = IsValid(Character) ? Character->GetCapsuleComponent()->GetComponentScale().Z : 1.0f;
+
+#if ENABLE_DRAW_DEBUG
+	const auto bDisplayDebug{UAlsUtility::ShouldDisplayDebugForActor(Mesh.GetOwner(), UAlsConstants::TracesDebugDisplayName())};
+#endif
+
+	const auto TraceStart{Surface.FootTransform.GetLocation()};
+	const auto TraceEnd{
+		TraceStart - Surface.FootTransform.TransformVectorNoScale(TraceSettings.FootZAxis) *
+		(TraceSettings.TraceDistance * Surface.CapsuleScale)
+	};
+
+	auto* SurfaceCache{
+		IsValid(Character)
+			? &Character->GetFootstepSurfaceCache(FootBone, TraceSettings.TraceChannel, TraceSettings.TraceDistance)
+			: nullptr
+	};
+
+	FCollisionQueryParams QueryParameters{ANSI_TO_TCHAR(__FUNCTION__), true, Mesh.GetOwner()};
+	QueryParameters.bReturnPhysicalMaterial = true;
+
+	if (SurfaceCache != nullptr &&
+	    ALSXTFootstepEffectsSubsystem::TryGetCachedSurfaceHit(*SurfaceCache, *Character, TraceStart, TraceEnd,
+	                                                          TraceSettings.CacheDistance * Surface.CapsuleScale, Surface.Hit))
+	{
+		// Move the anchor along with the foot, so the cache keeps hitting while the character walks across the floor.
+
+		SurfaceCache->ImpactPoint = Surface.Hit.ImpactPoint;
+	}
+	else
+	{
+		ALSXT_INC_DWORD_STAT(STAT_ALSXT_Traces);
+
+		if (World->LineTraceSingleByChannel(Surface.Hit, TraceStart, TraceEnd,
+		                                    UEngineTypes::ConvertToCollisionChannel(TraceSettings.TraceChannel), QueryParameters))
+		{
+			if (SurfaceCache != nullptr)
+			{
+				SurfaceCache->Component = Surface.Hit.Component;
+				SurfaceCache->PhysicalMaterial = Surface.Hit.PhysMaterial;
+				SurfaceCache->ImpactPoint = Surface.Hit.ImpactPoint;
+				SurfaceCache->ImpactNormal = Surface.Hit.ImpactNormal;
+				SurfaceCache->bValid = true;
+			}
+
+#if ENABLE_DRAW_DEBUG
+			if (bDisplayDebug)
+			{
+				UAlsUtility::DrawDebugLineTraceSingle(World, Surface.Hit.TraceStart, Surface.Hit.TraceEnd, Surface.Hit.bBlockingHit,
+				                                      Surface.Hit, {0.333333f, 0.0f, 0.0f}, FLinearColor::Red, 10.0f);
+			}
+#endif
+		}
+		else
+		{
+			if (SurfaceCache != nullptr)
+			{
+				SurfaceCache->bValid = false;
+			}
+
+			Surface.Hit = FHitResult{};
+			Surface.Hit.ImpactPoint = TraceStart;
+			Surface.Hit.ImpactNormal = FVector::UpVector;
+		}
+	}
+
+	Surface.SurfaceType = Surface.Hit.PhysMaterial.IsValid() ? Surface.Hit.PhysMaterial->SurfaceType.GetValue() : SurfaceType_Default;
+	Surface.Location = Surface.Hit.ImpactPoint;
+	Surface.Rotation = FRotationMatrix::MakeFromZY(Surface.Hit.ImpactNormal,
+	                                               Surface.FootTransform.TransformVectorNoScale(TraceSettings.FootYAxis)).ToQuat();
+
+#if ENABLE_DRAW_DEBUG
+	if (bDisplayDebug)
+	{
+		DrawDebugCoordinateSystem(World, Surface.Location, Surface.Rotation.Rotator(),
+		                          25.0f, false, 10.0f, 0, UAlsUtility::DrawLineThickness);
+	}
+#endif
+}
+
+UDecalComponent* UALSXTFootstepEffectsSubsystem::SpawnFootprintDecal(UMaterialInterface* Material, const FVector& Size,
+                                                                     USceneComponent* AttachComponent, const FVector& Location,
+                                                                     const FRotator& Rotation, const bool bCreateMaterialInstance,
+                                                                     UMaterialInstanceDynamic*& MaterialInstance)
+{
+	MaterialInstance = nullptr;
+
+	auto* World{GetWorld()};
+	if (!IsValid(Material) || !IsValid(World) || !IsValid(World->GetWorldSettings()))
+	{
+		return nullptr;
+	}
+
+	FALSXTPooledFootprintDecal* PooledDecal;
+
+	if (FootprintDecals.Num() < FootprintDecalBudget)
+	{
+		PooledDecal = &FootprintDecals.AddDefaulted_GetRef();
+	}
+	else
+	{
+		PooledDecal = &FootprintDecals[NextFootprintDecalIndex];
+		NextFootprintDecalIndex = (NextFootprintDecalIndex + 1) % FootprintDecalBudget;
+	}
+
+	auto* Decal{PooledDecal->Decal.Get()};
+
+	if (!IsValid(Decal))
+	{
+		Decal = NewObject<UDecalComponent>(World->GetWorldSettings(), NAME_None, RF_Transient);
+		Decal->RegisterComponentWithWorld(World);
+
+		PooledDecal->Decal = Decal;
+	}
+
+	if (IsValid(AttachComponent))
+	{
+		Decal->SetWorldLocationAndRotation(Location, Rotation);
+		Decal->AttachToComponent(AttachComponent, FAttachmentTransformRules::KeepWorldTransform);
+	}
+	else
+	{
+		Decal->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		Decal->SetWorldLocationAndRotation(Location, Rotation);
+	}
+
+	Decal->DecalSize = Size;
+
+	// Clear the fade out of the previous use, the decal stays until the caller sets a new one or it gets recycled.
+
+	Decal->SetFadeOut(0.0f, 0.0f, false);
+	Decal->MarkRenderStateDirty();
+
+	if (!bCreateMaterialInstance)
+	{
+		Decal->SetDecalMaterial(Material);
+		return Decal;
+	}
+
+	auto* FoundMaterialInstance{
+		PooledDecal->MaterialInstances.FindByPredicate([Material](const UMaterialInstanceDynamic* Instance)
+		{
+			return IsValid(Instance) && Instance->Parent == Material;
+		})
+	};
+
+	MaterialInstance = FoundMaterialInstance != nullptr
+		                   ? FoundMaterialInstance->Get()
+		                   : PooledDecal->MaterialInstances.Add_GetRef(UMaterialInstanceDynamic::Create(Material, this)).Get();
+
+	Decal->SetDecalMaterial(MaterialInstance);
+
+	return Decal;
+}
+
+void UALSXTFootstepEffectsSubsystem::SetFootprintDecalFadeOut(UDecalComponent* Decal, const float StartDelay, const float Duration)
+{
+	if (!IsValid(Decal))
+	{
+		return;
+	}
+
+	Decal->SetFadeOut(StartDelay, Duration, false);
+
+	// The fade out sets a life span that destroys the component once it ends.
+
+	Decal->SetLifeSpan(0.0f);
+}
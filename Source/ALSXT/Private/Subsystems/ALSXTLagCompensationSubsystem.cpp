@@ -0,0 +1,388 @@
+#include "Subsystems/ALSXTLagCompensationSubsystem.h"
+
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTLagCompensationSubsystem)
+
+bool UALSXTLagCompensationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const auto* World{Cast<UWorld>(Outer)};
+	return IsValid(World) && World->IsGameWorld();
+}
+
+TStatId UALSXTLagCompensationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UALSXTLagCompensationSubsystem, STATGROUP_Tickables)
+}
+
+void UALSXTLagCompensationSubsystem::Tick(const float DeltaTime)
+{
+	// Hits received this frame are validated against the history recorded up to the previous frame.
+
+	ProcessHitValidationRequests();
+	RecordCharacters();
+}
+
+void UALSXTLagCompensationSubsystem::RegisterCharacter(ACharacter* Character)
+{
+	if (!IsValid(Character) || Characters.Contains(Character))
+	{
+		return;
+	}
+
+	int32 SlotIndex;
+	if (FreeSlots.Num() > 0)
+	{
+		SlotIndex = FreeSlots.Pop(false);
+		Characters[SlotIndex] = Character;
+	}
+	else
+	{
+		SlotIndex = Characters.Add(Character);
+
+		CapsuleLocations.SetNum(Characters.Num() * HistorySize);
+		CapsuleRotations.SetNum(Characters.Num() * HistorySize);
+		CapsuleSizes.SetNum(Characters.Num() * HistorySize);
+
+		BodyCounts.SetNum(Characters.Num());
+		BodyBoneIndices.SetNum(Characters.Num() * MaxBodies);
+		BodyCenters.SetNum(Characters.Num() * MaxBodies);
+		BodyRadii.SetNum(Characters.Num() * MaxBodies);
+		BodyLocations.SetNum(Characters.Num() * HistorySize * MaxBodies);
+
+		RewoundLocations.SetNum(Characters.Num());
+		RewoundRotations.SetNum(Characters.Num());
+		RewoundSizes.SetNum(Characters.Num());
+		RewoundBodyLocations.SetNum(Characters.Num() * MaxBodies);
+	}
+
+	InitializeBodies(*Character, SlotIndex);
+
+	// Fill the whole history of the slot with the current pose, so that a
+	// rewind never returns the samples of the previous owner of the slot.
+
+	for (auto SampleIndex{0}; SampleIndex < HistorySize; SampleIndex++)
+	{
+		RecordCharacter(*Character, SlotIndex, SampleIndex);
+	}
+}
+
+void UALSXTLagCompensationSubsystem::InitializeBodies(const ACharacter& Character, const int32 SlotIndex)
+{
+	BodyCounts[SlotIndex] = 0;
+
+	const auto* Mesh{Character.GetMesh()};
+	const auto* PhysicsAsset{IsValid(Mesh) ? Mesh->GetPhysicsAsset() : nullptr};
+	if (!IsValid(PhysicsAsset))
+	{
+		return;
+	}
+
+	const auto Scale{UE_REAL_TO_FLOAT(Mesh->GetComponentScale().GetAbsMax())};
+
+	for (const auto* BodySetup : PhysicsAsset->SkeletalBodySetups)
+	{
+		if (BodyCounts[SlotIndex] >= MaxBodies)
+		{
+			break;
+		}
+
+		const auto BoneIndex{IsValid(BodySetup) ? Mesh->GetBoneIndex(BodySetup->BoneName) : INDEX_NONE};
+		if (BoneIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		// Each body is approximated by the bounding sphere of its shapes in bone space.
+
+		const auto Bounds{BodySetup->AggGeom.CalcAABB(FTransform::Identity)};
+		if (!Bounds.IsValid)
+		{
+			continue;
+		}
+
+		const auto BodyIndex{SlotIndex * MaxBodies + BodyCounts[SlotIndex]};
+
+		BodyBoneIndices[BodyIndex] = BoneIndex;
+		BodyCenters[BodyIndex] = FVector3f{Bounds.GetCenter()};
+		BodyRadii[BodyIndex] = UE_REAL_TO_FLOAT(Bounds.GetExtent().Size()) * Scale;
+
+		BodyCounts[SlotIndex] += 1;
+	}
+}
+
+void UALSXTLagCompensationSubsystem::RequestHitValidation(ACharacter* Target, const FVector& HitLocation, const double Time,
+                                                          FHitValidatedDelegate&& OnValidated)
+{
+	auto& Request{PendingRequests.AddDefaulted_GetRef()};
+	Request.Target = Target;
+	Request.HitLocation = HitLocation;
+	Request.Time = Time;
+	Request.OnValidated = MoveTemp(OnValidated);
+}
+
+double UALSXTLagCompensationSubsystem::GetServerTime() const
+{
+	const auto* World{GetWorld()};
+	const auto* GameState{World->GetGameState()};
+
+	return IsValid(GameState) ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+double UALSXTLagCompensationSubsystem::GetRewindTime(const ACharacter& Attacker, const double ClientTime) const
+{
+	const auto ServerTime{GetServerTime()};
+
+	const auto* PlayerState{Attacker.GetPlayerState()};
+	const auto RoundTripTime{IsValid(PlayerState) ? PlayerState->GetPingInMilliseconds() * 0.001 : 0.0};
+
+	// Without a time from the client, assume the hit happened half a round trip ago.
+
+	if (ClientTime <= 0.0)
+	{
+		return ServerTime - RoundTripTime * 0.5;
+	}
+
+	return FMath::Clamp(ClientTime, ServerTime - FMath::Min(RoundTripTime + RewindTimeTolerance, static_cast<double>(MaxRewindTime)),
+	                    ServerTime);
+}
+
+void UALSXTLagCompensationSubsystem::ProcessHitValidationRequests()
+{
+	if (PendingRequests.Num() <= 0)
+	{
+		return;
+	}
+
+	// Sort the requests by time, so that each distinct time is rewound only once for the whole frame.
+
+	PendingRequests.Sort([](const FHitValidationRequest& A, const FHitValidationRequest& B)
+	{
+		return A.Time < B.Time;
+	});
+
+	// Move the requests out first, since a callback may request another validation.
+
+	auto Requests{MoveTemp(PendingRequests)};
+	PendingRequests.Reset();
+
+	auto RewoundTime{-1.0};
+	auto bRewound{false};
+
+	for (auto& Request : Requests)
+	{
+		if (Request.Time != RewoundTime)
+		{
+			RewoundTime = Request.Time;
+			bRewound = RewindCharacters(Request.Time);
+		}
+
+		auto SlotIndex{Request.Target.IsValid() ? Characters.IndexOfByKey(Request.Target) : INDEX_NONE};
+		auto bValid{false};
+
+		if (Request.Target.IsValid() && (SlotIndex == INDEX_NONE || SampleCount <= 0))
+		{
+			// The target has no history yet, validate the hit against its current pose.
+
+			RegisterCharacter(Request.Target.Get());
+			SlotIndex = Characters.IndexOfByKey(Request.Target);
+
+			if (SampleCount <= 0)
+			{
+				RecordCharacter(*Request.Target, SlotIndex, 0);
+			}
+
+			RewindCharacterToSample(SlotIndex, 0);
+			bValid = IsHitOnCharacter(SlotIndex, Request.HitLocation);
+
+			// Rewound again for the next request, since this slot no longer holds the rewound pose.
+			RewoundTime = -1.0;
+		}
+		else if (bRewound && SlotIndex != INDEX_NONE)
+		{
+			bValid = IsHitOnCharacter(SlotIndex, Request.HitLocation);
+		}
+
+		if (Request.OnValidated)
+		{
+			Request.OnValidated(bValid);
+		}
+	}
+}
+
+bool UALSXTLagCompensationSubsystem::IsHitOnCharacter(const int32 SlotIndex, const FVector& HitLocation) const
+{
+	const auto& Size{RewoundSizes[SlotIndex]};
+	const auto CapsuleSegmentHalfLength{FMath::Max(0.0f, Size.Y - Size.X)};
+
+	const auto LocalHitLocation{
+		RewoundRotations[SlotIndex].UnrotateVector(FVector3f{HitLocation - RewoundLocations[SlotIndex]})
+	};
+
+	const FVector3f ClosestSegmentPoint{
+		0.0f, 0.0f, FMath::Clamp(LocalHitLocation.Z, -CapsuleSegmentHalfLength, CapsuleSegmentHalfLength)
+	};
+
+	if (FVector3f::DistSquared(LocalHitLocation, ClosestSegmentPoint) <= FMath::Square(Size.X + HitTolerance))
+	{
+		return true;
+	}
+
+	// Limbs and held items reach outside the capsule, so test the bodies as well.
+
+	for (auto i{SlotIndex * MaxBodies}; i < SlotIndex * MaxBodies + BodyCounts[SlotIndex]; i++)
+	{
+		if (FVector::DistSquared(HitLocation, RewoundBodyLocations[i]) <= FMath::Square(BodyRadii[i] + HitTolerance))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UALSXTLagCompensationSubsystem::RewindCharacterToSample(const int32 SlotIndex, const int32 SampleIndex)
+{
+	const auto Index{SlotIndex * HistorySize + SampleIndex};
+
+	RewoundLocations[SlotIndex] = CapsuleLocations[Index];
+	RewoundRotations[SlotIndex] = CapsuleRotations[Index];
+	RewoundSizes[SlotIndex] = CapsuleSizes[Index];
+
+	for (auto BodyIndex{0}; BodyIndex < BodyCounts[SlotIndex]; BodyIndex++)
+	{
+		RewoundBodyLocations[SlotIndex * MaxBodies + BodyIndex] = BodyLocations[Index * MaxBodies + BodyIndex];
+	}
+}
+
+bool UALSXTLagCompensationSubsystem::RewindCharacters(const double Time)
+{
+	if (SampleCount <= 0)
+	{
+		return false;
+	}
+
+	const auto NewestTime{SampleTimes[HeadSampleIndex]};
+	if (NewestTime - Time > MaxRewindTime)
+	{
+		return false;
+	}
+
+	// Find the two samples around the time, walking from the newest sample back.
+
+	auto NewerSampleIndex{HeadSampleIndex};
+	auto OlderSampleIndex{HeadSampleIndex};
+
+	for (auto i{1}; i < SampleCount && SampleTimes[OlderSampleIndex] > Time; i++)
+	{
+		NewerSampleIndex = OlderSampleIndex;
+		OlderSampleIndex = (HeadSampleIndex - i + HistorySize) % HistorySize;
+	}
+
+	if (SampleTimes[OlderSampleIndex] > Time)
+	{
+		// The time is older than the whole history.
+		return false;
+	}
+
+	const auto SampleDeltaTime{SampleTimes[NewerSampleIndex] - SampleTimes[OlderSampleIndex]};
+	const auto Alpha{
+		SampleDeltaTime > UE_SMALL_NUMBER
+			? static_cast<float>(FMath::Clamp((Time - SampleTimes[OlderSampleIndex]) / SampleDeltaTime, 0.0, 1.0))
+			: 0.0f
+	};
+
+	for (auto SlotIndex{0}; SlotIndex < Characters.Num(); SlotIndex++)
+	{
+		const auto OlderIndex{SlotIndex * HistorySize + OlderSampleIndex};
+		const auto NewerIndex{SlotIndex * HistorySize + NewerSampleIndex};
+
+		RewoundLocations[SlotIndex] = FMath::Lerp(CapsuleLocations[OlderIndex], CapsuleLocations[NewerIndex], Alpha);
+		RewoundRotations[SlotIndex] = FQuat4f::FastLerp(CapsuleRotations[OlderIndex], CapsuleRotations[NewerIndex], Alpha).GetNormalized();
+		RewoundSizes[SlotIndex] = FMath::Lerp(CapsuleSizes[OlderIndex], CapsuleSizes[NewerIndex], Alpha);
+
+		for (auto BodyIndex{0}; BodyIndex < BodyCounts[SlotIndex]; BodyIndex++)
+		{
+			RewoundBodyLocations[SlotIndex * MaxBodies + BodyIndex] = FMath::Lerp(BodyLocations[OlderIndex * MaxBodies + BodyIndex],
+			                                                                      BodyLocations[NewerIndex * MaxBodies + BodyIndex], Alpha);
+		}
+	}
+
+	return true;
+}
+
+void UALSXTLagCompensationSubsystem::RecordCharacters()
+{
+	if (Characters.Num() <= 0)
+	{
+		return;
+	}
+
+	HeadSampleIndex = (HeadSampleIndex + 1) % HistorySize;
+	SampleCount = FMath::Min(SampleCount + 1, HistorySize);
+	SampleTimes[HeadSampleIndex] = GetServerTime();
+
+	for (auto SlotIndex{0}; SlotIndex < Characters.Num(); SlotIndex++)
+	{
+		const auto* Character{Characters[SlotIndex].Get()};
+		if (!IsValid(Character))
+		{
+			if (!Characters[SlotIndex].IsExplicitlyNull())
+			{
+				Characters[SlotIndex].Reset();
+				FreeSlots.Add(SlotIndex);
+			}
+
+			continue;
+		}
+
+		RecordCharacter(*Character, SlotIndex, HeadSampleIndex);
+	}
+}
+
+void UALSXTLagCompensationSubsystem::RecordCharacter(const ACharacter& Character, const int32 SlotIndex, const int32 SampleIndex)
+{
+	const auto* Capsule{Character.GetCapsuleComponent()};
+	const auto Index{SlotIndex * HistorySize + SampleIndex};
+
+	CapsuleLocations[Index] = Capsule->GetComponentLocation();
+	CapsuleRotations[Index] = FQuat4f{Capsule->GetComponentQuat()};
+	CapsuleSizes[Index] = {Capsule->GetScaledCapsuleRadius(), Capsule->GetScaledCapsuleHalfHeight()};
+
+	const auto* Mesh{Character.GetMesh()};
+	if (BodyCounts[SlotIndex] <= 0 || !IsValid(Mesh))
+	{
+		return;
+	}
+
+	const auto& ComponentTransform{Mesh->GetComponentTransform()};
+	const auto& BoneTransforms{Mesh->GetComponentSpaceTransforms()};
+
+	for (auto BodyIndex{0}; BodyIndex < BodyCounts[SlotIndex]; BodyIndex++)
+	{
+		const auto SlotBodyIndex{SlotIndex * MaxBodies + BodyIndex};
+		const auto BoneIndex{BodyBoneIndices[SlotBodyIndex]};
+
+		// Meshes following a leader pose have no bone transforms of their own, their bodies stay at the component.
+
+		const auto ComponentLocation{
+			BoneTransforms.IsValidIndex(BoneIndex)
+				? BoneTransforms[BoneIndex].TransformPosition(FVector{BodyCenters[SlotBodyIndex]})
+				: FVector::ZeroVector
+		};
+
+		BodyLocations[Index * MaxBodies + BodyIndex] = ComponentTransform.TransformPosition(ComponentLocation);
+	}
+}
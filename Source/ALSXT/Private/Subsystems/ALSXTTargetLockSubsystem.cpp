@@ -0,0 +1,184 @@
+#include "Subsystems/ALSXTTargetLockSubsystem.h"
+
+#include "EngineUtils.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Interfaces/ALSXTTargetLockInterface.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTTargetLockSubsystem)
+
+bool UALSXTTargetLockSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const auto* World{Cast<UWorld>(Outer)};
+	return IsValid(World) && World->IsGameWorld();
+}
+
+void UALSXTTargetLockSubsystem::OnWorldBeginPlay(UWorld& World)
+{
+	Super::OnWorldBeginPlay(World);
+
+	for (TActorIterator<AActor> Iterator{&World}; Iterator; ++Iterator)
+	{
+		OnActorSpawned(*Iterator);
+	}
+
+	ActorSpawnedHandle = World.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &ThisClass::OnActorSpawned));
+	ActorDestroyedHandle = World.AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &ThisClass::OnActorDestroyed));
+
+	// Actors of streamed levels and world partition cells are loaded rather than spawned.
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ThisClass::OnLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ThisClass::OnLevelRemovedFromWorld);
+}
+
+void UALSXTTargetLockSubsystem::Deinitialize()
+{
+	auto* World{GetWorld()};
+	if (IsValid(World))
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	Targets.Reset();
+	GridCells.Reset();
+
+	Super::Deinitialize();
+}
+
+void UALSXTTargetLockSubsystem::RegisterTarget(AActor* Actor)
+{
+	if (IsValid(Actor) && !Targets.Contains(Actor))
+	{
+		Targets.Add(Actor);
+		GridRefreshTime = -1.0;
+	}
+}
+
+void UALSXTTargetLockSubsystem::UnregisterTarget(AActor* Actor)
+{
+	if (Targets.RemoveSingleSwap(Actor) > 0)
+	{
+		GridRefreshTime = -1.0;
+	}
+}
+
+void UALSXTTargetLockSubsystem::GatherTargets(const FVector& Location, const float Radius, TArray<AActor*>& OutTargets)
+{
+	if (GridRefreshTime < 0.0 || GetWorld()->GetTimeSeconds() - GridRefreshTime >= GridRefreshInterval)
+	{
+		RefreshGrid();
+	}
+
+	// Targets may have moved since the grid was refreshed, so look one cell further.
+
+	const auto MinCell{GetGridCell(Location - FVector{Radius}) - FIntVector{1}};
+	const auto MaxCell{GetGridCell(Location + FVector{Radius}) + FIntVector{1}};
+	const auto RadiusSquared{FMath::Square(Radius)};
+
+	for (auto X{MinCell.X}; X <= MaxCell.X; X++)
+	{
+		for (auto Y{MinCell.Y}; Y <= MaxCell.Y; Y++)
+		{
+			for (auto Z{MinCell.Z}; Z <= MaxCell.Z; Z++)
+			{
+				const auto* Cell{GridCells.Find({X, Y, Z})};
+				if (Cell == nullptr)
+				{
+					continue;
+				}
+
+				for (const auto TargetIndex : *Cell)
+				{
+					auto* Target{Targets[TargetIndex].Get()};
+					if (IsValid(Target) && FVector::DistSquared(Target->GetActorLocation(), Location) <= RadiusSquared)
+					{
+						OutTargets.Add(Target);
+					}
+				}
+			}
+		}
+	}
+}
+
+void UALSXTTargetLockSubsystem::OnActorSpawned(AActor* Actor)
+{
+	if (IsValid(Actor) && Actor->GetClass()->ImplementsInterface(UALSXTTargetLockInterface::StaticClass()))
+	{
+		RegisterTarget(Actor);
+	}
+}
+
+void UALSXTTargetLockSubsystem::OnActorDestroyed(AActor* Actor)
+{
+	UnregisterTarget(Actor);
+}
+
+void UALSXTTargetLockSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld() || !IsValid(Level))
+	{
+		return;
+	}
+
+	for (auto* Actor : Level->Actors)
+	{
+		OnActorSpawned(Actor);
+	}
+}
+
+void UALSXTTargetLockSubsystem::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	// A null level means that all levels are removed.
+
+	const auto RemovedCount{
+		Targets.RemoveAllSwap([Level](const TWeakObjectPtr<AActor>& Target)
+		{
+			return !Target.IsValid() || Level == nullptr || Target->GetLevel() == Level;
+		})
+	};
+
+	if (RemovedCount > 0)
+	{
+		GridRefreshTime = -1.0;
+	}
+}
+
+void UALSXTTargetLockSubsystem::RefreshGrid()
+{
+	GridRefreshTime = GetWorld()->GetTimeSeconds();
+
+	Targets.RemoveAllSwap([](const TWeakObjectPtr<AActor>& Target)
+	{
+		return !Target.IsValid();
+	});
+
+	GridCells.Reset();
+
+	for (auto i{0}; i < Targets.Num(); i++)
+	{
+		GridCells.FindOrAdd(GetGridCell(Targets[i]->GetActorLocation())).Add(i);
+	}
+}
+
+FIntVector UALSXTTargetLockSubsystem::GetGridCell(const FVector& Location)
+{
+	return {
+		FMath::FloorToInt32(Location.X / GridCellSize),
+		FMath::FloorToInt32(Location.Y / GridCellSize),
+		FMath::FloorToInt32(Location.Z / GridCellSize)
+	};
+}
@@ -0,0 +1,76 @@
+#include "Utility/ALSXTInterfaceUtility.h"
+
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+#include "Interfaces/ALSXTCollisionInterface.h"
+
+namespace ALSXTInterfaceUtility
+{
+	// Compares both paths of a hot collision interface call on the first actor implementing the interface natively.
+
+	void RunBenchmark(const TArray<FString>& Arguments, UWorld* World)
+	{
+		const auto IterationCount{Arguments.Num() > 0 ? FMath::Max(FCString::Atoi(*Arguments[0]), 1) : 100000};
+
+		AActor* Actor{nullptr};
+
+		for (TActorIterator<AActor> Iterator{World}; Iterator; ++Iterator)
+		{
+			if (Cast<IALSXTCollisionInterface>(*Iterator) != nullptr)
+			{
+				Actor = *Iterator;
+				break;
+			}
+		}
+
+		if (!IsValid(Actor))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ALSXT interface benchmark: no actor implements the collision interface natively."));
+			return;
+		}
+
+		FVector Velocity;
+
+		auto StartTime{FPlatformTime::Seconds()};
+
+		for (auto i{0}; i < IterationCount; i++)
+		{
+			IALSXTCollisionInterface::Execute_GetActorVelocity(Actor, Velocity);
+		}
+
+		const auto ExecuteTime{FPlatformTime::Seconds() - StartTime};
+
+		StartTime = FPlatformTime::Seconds();
+
+		for (auto i{0}; i < IterationCount; i++)
+		{
+			ALSXT_EXECUTE_NATIVE(IALSXTCollisionInterface, GetActorVelocity, Actor, Velocity);
+		}
+
+		const auto NativeTime{FPlatformTime::Seconds() - StartTime};
+
+		UE_LOG(LogTemp, Log, TEXT("ALSXT interface benchmark: %d calls of GetActorVelocity on %s, Execute_ %.1f ns per call,")
+		       TEXT(" fast path %.1f ns per call (%s)."), IterationCount, *Actor->GetName(), ExecuteTime * 1.0e9 / IterationCount,
+		       NativeTime * 1.0e9 / IterationCount,
+		       IsImplementedNatively<IALSXTCollisionInterface>(
+			       Actor, GET_FUNCTION_NAME_CHECKED(IALSXTCollisionInterface, GetActorVelocity))
+			       ? TEXT("native")
+			       : TEXT("overridden in Blueprint"));
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs BenchmarkConsoleCommand{
+		TEXT("alsxt.Interface.Benchmark"),
+		TEXT("Times interface calls through Execute_ and through the native fast path. Arguments: [IterationCount]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunBenchmark)
+	};
+}
+
+bool ALSXTInterfaceUtility::IsFunctionImplementedInBlueprint(const UClass& Class, const FName FunctionName)
+{
+	// Blueprint implementations are found before the interface function. Not cached here, since Blueprint compilation
+	// may add or remove them, while the class function lookup is already cached by the engine and kept up to date.
+
+	const auto* Function{Class.FindFunctionByName(FunctionName)};
+	return Function != nullptr && !Function->GetOwnerClass()->HasAnyClassFlags(CLASS_Interface);
+}
@@ -0,0 +1,298 @@
+#include "Utility/ALSXTNetAccounting.h"
+
+#include "HAL/IConsoleManager.h"
+#include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTNetAccounting)
+
+namespace ALSXTNetAccounting
+{
+	struct FEntry
+	{
+		uint64 Bits{0};
+
+		uint32 Count{0};
+
+		bool bRpc{false};
+	};
+
+	struct FAccountingState
+	{
+		TMap<FString, FEntry> Entries;
+
+		// The last serialized value of each accounted property, per object.
+		TMap<TObjectKey<UObject>, TMap<const FProperty*, TArray<uint8>>> PropertyValues;
+
+		TMap<TObjectKey<UClass>, TArray<const FProperty*>> ReplicatedProperties;
+
+		TSet<TObjectKey<AActor>> Actors;
+
+		double StartTime{0.0};
+	};
+
+	bool bEnabled{false};
+
+	float CharacterBudget{0.0f};
+
+	FAccountingState& GetState()
+	{
+		static FAccountingState State;
+		return State;
+	}
+
+	void OnEnabledChanged(IConsoleVariable* ConsoleVariable)
+	{
+		ResetReport();
+	}
+
+	FAutoConsoleVariableRef EnabledConsoleVariable{
+		TEXT("alsxt.Net.Accounting"), bEnabled,
+		TEXT("Attributes the bits sent for ALSXT replicated properties and RPCs. Resets the report when changed."),
+		FConsoleVariableDelegate::CreateStatic(&OnEnabledChanged)
+	};
+
+	FAutoConsoleVariableRef CharacterBudgetConsoleVariable{
+		TEXT("alsxt.Net.CharacterBudget"), CharacterBudget,
+		TEXT("Bytes per character per second the network accounting report total should stay under, 0 disables the check.")
+	};
+
+	FAutoConsoleCommand DumpReportConsoleCommand{
+		TEXT("alsxt.Net.DumpReport"), TEXT("Logs the ALSXT network accounting report."),
+		FConsoleCommandDelegate::CreateLambda([]
+		{
+			DumpReport();
+		})
+	};
+
+	FAutoConsoleCommand ResetReportConsoleCommand{
+		TEXT("alsxt.Net.ResetReport"), TEXT("Clears the ALSXT network accounting report."),
+		FConsoleCommandDelegate::CreateStatic(&ResetReport)
+	};
+
+	// Serializes the value the way the replication layout does, which sends arrays and structs without a native
+	// net serializer as their individual elements and fields.
+
+	void SerializeValue(FNetBitWriter& Writer, const FProperty& Property, void* Value)
+	{
+		const auto* ArrayProperty{CastField<FArrayProperty>(&Property)};
+		if (ArrayProperty != nullptr)
+		{
+			FScriptArrayHelper ArrayHelper{ArrayProperty, Value};
+
+			auto ElementCount{static_cast<uint32>(ArrayHelper.Num())};
+			Writer.SerializeIntPacked(ElementCount);
+
+			for (auto i{0}; i < ArrayHelper.Num(); i++)
+			{
+				SerializeValue(Writer, *ArrayProperty->Inner, ArrayHelper.GetRawPtr(i));
+			}
+
+			return;
+		}
+
+		const auto* StructProperty{CastField<FStructProperty>(&Property)};
+		if (StructProperty != nullptr && (StructProperty->Struct->StructFlags & STRUCT_NetSerializeNative) == 0)
+		{
+			for (TFieldIterator<FProperty> Iterator{StructProperty->Struct}; Iterator; ++Iterator)
+			{
+				if (Iterator->HasAnyPropertyFlags(CPF_RepSkip))
+				{
+					continue;
+				}
+
+				for (auto i{0}; i < Iterator->ArrayDim; i++)
+				{
+					SerializeValue(Writer, **Iterator, Iterator->ContainerPtrToValuePtr<void>(Value, i));
+				}
+			}
+
+			return;
+		}
+
+		Property.NetSerializeItem(Writer, GetMutableDefault<UALSXTNetAccountingPackageMap>(), Value);
+	}
+
+	const TArray<const FProperty*>& GetReplicatedProperties(const UClass& Class)
+	{
+		auto& ReplicatedProperties{GetState().ReplicatedProperties};
+
+		const auto* CachedProperties{ReplicatedProperties.Find(&Class)};
+		if (CachedProperties != nullptr)
+		{
+			return *CachedProperties;
+		}
+
+		static const FName ModulePackageName{TEXT("/Script/ALSXT")};
+
+		auto& Properties{ReplicatedProperties.Add(&Class)};
+
+		for (TFieldIterator<FProperty> Iterator{&Class}; Iterator; ++Iterator)
+		{
+			if (Iterator->HasAnyPropertyFlags(CPF_Net) && Iterator->GetOwnerClass()->GetOutermost()->GetFName() == ModulePackageName)
+			{
+				Properties.Add(*Iterator);
+			}
+		}
+
+		return Properties;
+	}
+
+	void AddEntry(const UObject& Object, const FString& Name, const int64 Bits, const bool bRpc)
+	{
+		auto& State{GetState()};
+
+		auto& Entry{State.Entries.FindOrAdd(Name)};
+		Entry.Bits += Bits;
+		Entry.Count += 1;
+		Entry.bRpc = bRpc;
+
+		const auto* Actor{Cast<AActor>(&Object)};
+		if (!IsValid(Actor))
+		{
+			Actor = Object.GetTypedOuter<AActor>();
+		}
+
+		if (IsValid(Actor))
+		{
+			State.Actors.Add(Actor);
+		}
+	}
+}
+
+bool UALSXTNetAccountingPackageMap::SerializeObject(FArchive& Archive, UClass* Class, UObject*& Object, FNetworkGUID* OutNetGuid)
+{
+	auto NetGuidStandIn{IsValid(Object) ? Object->GetUniqueID() : 0u};
+	Archive.SerializeIntPacked(NetGuidStandIn);
+
+	return true;
+}
+
+bool ALSXTNetAccounting::IsEnabled()
+{
+	return bEnabled;
+}
+
+void ALSXTNetAccounting::RecordReplicatedProperties(const UObject& Object)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	auto& PropertyValues{GetState().PropertyValues.FindOrAdd(&Object)};
+
+	for (const auto* Property : GetReplicatedProperties(*Object.GetClass()))
+	{
+		FNetBitWriter Writer{GetMutableDefault<UALSXTNetAccountingPackageMap>(), 0};
+
+		for (auto i{0}; i < Property->ArrayDim; i++)
+		{
+			SerializeValue(Writer, *Property, const_cast<void*>(Property->ContainerPtrToValuePtr<void>(&Object, i)));
+		}
+
+		// Properties are only sent when their value changed. The bit count is stored
+		// in front of the bytes, since values may differ only in their bit count.
+
+		const auto BitCount{Writer.GetNumBits()};
+
+		TArray<uint8> Value;
+		Value.Reserve(sizeof(BitCount) + Writer.GetNumBytes());
+		Value.Append(reinterpret_cast<const uint8*>(&BitCount), sizeof(BitCount));
+		Value.Append(Writer.GetData(), Writer.GetNumBytes());
+
+		auto* PreviousValue{PropertyValues.Find(Property)};
+		if (PreviousValue != nullptr && *PreviousValue == Value)
+		{
+			continue;
+		}
+
+		PropertyValues.Add(Property, MoveTemp(Value));
+
+		AddEntry(Object, FString::Printf(TEXT("%s.%s"), *Property->GetOwnerClass()->GetName(), *Property->GetName()), BitCount, false);
+	}
+}
+
+void ALSXTNetAccounting::RecordRpc(const UObject& Object, const UFunction& Function, void* Parameters)
+{
+	static const FName PackageName{TEXT("/Script/ALSXT")};
+
+	// The movement RPCs of the character movement component and ALS are not part of the ALSXT budget.
+
+	if (!bEnabled || Function.GetOwnerClass()->GetOutermost()->GetFName() != PackageName)
+	{
+		return;
+	}
+
+	FNetBitWriter Writer{GetMutableDefault<UALSXTNetAccountingPackageMap>(), 0};
+
+	for (TFieldIterator<FProperty> Iterator{&Function}; Iterator && (Iterator->PropertyFlags & (CPF_Parm | CPF_ReturnParm)) == CPF_Parm;
+	     ++Iterator)
+	{
+		for (auto i{0}; i < Iterator->ArrayDim; i++)
+		{
+			SerializeValue(Writer, **Iterator, Iterator->ContainerPtrToValuePtr<void>(Parameters, i));
+		}
+	}
+
+	AddEntry(Object, FString::Printf(TEXT("%s.%s"), *Function.GetOwnerClass()->GetName(), *Function.GetName()),
+	         Writer.GetNumBits(), true);
+}
+
+bool ALSXTNetAccounting::DumpReport()
+{
+	const auto& State{GetState()};
+
+	const auto ElapsedTime{FMath::Max(FPlatformTime::Seconds() - State.StartTime, UE_DOUBLE_SMALL_NUMBER)};
+	const auto ActorCount{FMath::Max(State.Actors.Num(), 1)};
+	const auto BitsToBytesPerCharacterPerSecond{1.0 / (8.0 * ElapsedTime * ActorCount)};
+
+	TArray<TPair<FString, FEntry>> SortedEntries{State.Entries.Array()};
+	SortedEntries.Sort([](const TPair<FString, FEntry>& A, const TPair<FString, FEntry>& B)
+	{
+		return A.Value.Bits > B.Value.Bits;
+	});
+
+	UE_LOG(LogTemp, Log, TEXT("ALSXT network accounting: %.1f seconds, %d characters%s."), ElapsedTime, State.Actors.Num(),
+	       bEnabled ? TEXT("") : TEXT(", accounting disabled (alsxt.Net.Accounting 1)"));
+
+	UE_LOG(LogTemp, Log, TEXT("%16s %10s %14s  %s"), TEXT("Bytes/Char/Sec"), TEXT("Count"), TEXT("Total Bytes"), TEXT("Name"));
+
+	uint64 TotalBits{0};
+
+	for (const auto& Entry : SortedEntries)
+	{
+		UE_LOG(LogTemp, Log, TEXT("%16.2f %10u %14llu  %s%s"), Entry.Value.Bits * BitsToBytesPerCharacterPerSecond, Entry.Value.Count,
+		       FMath::DivideAndRoundUp(Entry.Value.Bits, static_cast<uint64>(8)), Entry.Value.bRpc ? TEXT("RPC ") : TEXT(""),
+		       *Entry.Key);
+
+		TotalBits += Entry.Value.Bits;
+	}
+
+	const auto TotalBytesPerCharacterPerSecond{TotalBits * BitsToBytesPerCharacterPerSecond};
+
+	UE_LOG(LogTemp, Log, TEXT("%16.2f %10s %14llu  Total"), TotalBytesPerCharacterPerSecond, TEXT(""),
+	       FMath::DivideAndRoundUp(TotalBits, static_cast<uint64>(8)));
+
+	if (CharacterBudget > 0.0f && TotalBytesPerCharacterPerSecond > CharacterBudget)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ALSXT network accounting: %.2f bytes per character per second is over the budget of %.2f."),
+		       TotalBytesPerCharacterPerSecond, CharacterBudget);
+
+		return false;
+	}
+
+	return true;
+}
+
+void ALSXTNetAccounting::ResetReport()
+{
+	auto& State{GetState()};
+
+	State.Entries.Reset();
+	State.PropertyValues.Reset();
+	State.Actors.Reset();
+	State.StartTime = FPlatformTime::Seconds();
+}
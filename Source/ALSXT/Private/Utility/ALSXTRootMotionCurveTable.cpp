@@ -0,0 +1,56 @@
+#include "Utility/ALSXTRootMotionCurveTable.h"
+
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+
+FALSXTRootMotionCurveTable::FALSXTRootMotionCurveTable()
+{
+	for (auto Index{0}; Index < SampleCount; Index++)
+	{
+		BlendInAmounts[Index] = 1.0f;
+		InterpolationAndCorrectionAmounts[Index] = FVector3f::ZeroVector;
+	}
+}
+
+void FALSXTRootMotionCurveTable::Bake(const UCurveFloat* BlendInCurve, const UCurveVector* InterpolationAndCorrectionAmountsCurve,
+                                      const float NewPlayRate, const float NewStartTime)
+{
+	PlayRate = NewPlayRate;
+	StartTime = NewStartTime;
+
+	if (IsValid(BlendInCurve))
+	{
+		auto MinTime{0.0f};
+		auto CurveMaxTime{0.0f};
+		BlendInCurve->GetTimeRange(MinTime, CurveMaxTime);
+
+		const auto Interval{(CurveMaxTime - MinTime) / (SampleCount - 1)};
+
+		BlendInMinTime = MinTime;
+		BlendInSampleRate = Interval > UE_SMALL_NUMBER ? 1.0f / Interval : 0.0f;
+
+		for (auto Index{0}; Index < SampleCount; Index++)
+		{
+			BlendInAmounts[Index] = BlendInCurve->GetFloatValue(MinTime + Interval * Index);
+		}
+	}
+
+	if (IsValid(InterpolationAndCorrectionAmountsCurve))
+	{
+		auto MinTime{0.0f};
+		auto CurveMaxTime{0.0f};
+		InterpolationAndCorrectionAmountsCurve->GetTimeRange(MinTime, CurveMaxTime);
+
+		const auto Interval{(CurveMaxTime - MinTime) / (SampleCount - 1)};
+
+		InterpolationAndCorrectionMinTime = MinTime;
+		InterpolationAndCorrectionSampleRate = Interval > UE_SMALL_NUMBER ? 1.0f / Interval : 0.0f;
+
+		for (auto Index{0}; Index < SampleCount; Index++)
+		{
+			InterpolationAndCorrectionAmounts[Index] = FVector3f{
+				InterpolationAndCorrectionAmountsCurve->GetVectorValue(MinTime + Interval * Index)
+			};
+		}
+	}
+}
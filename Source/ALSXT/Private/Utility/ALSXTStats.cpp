@@ -0,0 +1,73 @@
+#include "Utility/ALSXTStats.h"
+
+#include "GameFramework/Actor.h"
+#include "UObject/Class.h"
+#include "UObject/Package.h"
+
+ALSXT_DEFINE_STAT(STAT_ALSXT_ObstacleTrace, true);
+ALSXT_DEFINE_STAT(STAT_ALSXT_AnticipationTrace, true);
+ALSXT_DEFINE_STAT(STAT_ALSXT_AttackCollisionTrace, true);
+ALSXT_DEFINE_STAT(STAT_ALSXT_TryStartVaulting, true);
+ALSXT_DEFINE_STAT(STAT_ALSXT_SoundSelection, true);
+ALSXT_DEFINE_STAT(STAT_ALSXT_MeshPainting, true);
+ALSXT_DEFINE_STAT(STAT_ALSXT_FootstepNotify, true);
+ALSXT_DEFINE_STAT(STAT_ALSXT_EffectNotify, true);
+
+ALSXT_DEFINE_STAT(STAT_ALSXT_Traces, false);
+ALSXT_DEFINE_STAT(STAT_ALSXT_EffectsSpawned, false);
+ALSXT_DEFINE_STAT(STAT_ALSXT_RpcsSent, false);
+ALSXT_DEFINE_STAT(STAT_ALSXT_RpcParameterBytesEstimate, false);
+
+UE_TRACE_CHANNEL_DEFINE(ALSXTChannel);
+
+bool ALSXTStats::bBenchmarkCountersEnabled{false};
+
+namespace ALSXTStats
+{
+	TArray<FBenchmarkCounter*>& GetMutableBenchmarkCounters()
+	{
+		// Function local, so that it is constructed before the counters register themselves during static initialization.
+
+		static TArray<FBenchmarkCounter*> Counters;
+		return Counters;
+	}
+
+	// Excludes the RPCs of the character movement component and ALS that also go through the ALSXT actors and components.
+	bool IsALSXTFunction(const UFunction& Function)
+	{
+		static const FName PackageName{TEXT("/Script/ALSXT")};
+
+		return Function.GetOwnerClass()->GetOutermost()->GetFName() == PackageName;
+	}
+}
+
+ALSXTStats::FBenchmarkCounter::FBenchmarkCounter(const TCHAR* Name, const bool bCycles) : Name{Name}, bCycles{bCycles}
+{
+	GetMutableBenchmarkCounters().Add(this);
+}
+
+const TArray<ALSXTStats::FBenchmarkCounter*>& ALSXTStats::GetBenchmarkCounters()
+{
+	return GetMutableBenchmarkCounters();
+}
+
+FString ALSXTStats::GetTraceEventName(const AActor* Actor)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(ALSXTChannel) || !IsValid(Actor))
+	{
+		return FString{};
+	}
+
+	return Actor->GetName();
+}
+
+void ALSXTStats::RecordRpc(const UFunction* Function)
+{
+	if (!IsALSXTFunction(*Function))
+	{
+		return;
+	}
+
+	ALSXT_INC_DWORD_STAT(STAT_ALSXT_RpcsSent);
+	ALSXT_INC_DWORD_STAT_BY(STAT_ALSXT_RpcParameterBytesEstimate, Function->ParmsSize);
+}
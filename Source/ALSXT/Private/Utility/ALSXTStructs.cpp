@@ -0,0 +1,99 @@
+#include "Utility/ALSXTStructs.h"
+
+#include "Utility/ALSXTGameplayTagEnumUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSXTStructs)
+
+// Hit results are sent with every impact and attack reaction RPC. Tags of the impact form, impact side and
+// action strength families are sent as a single byte, everything else as the default serialization would.
+
+bool FExtendedHitResult::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	bSuccess = true;
+	auto bSuccessLocal{true};
+
+	uint8 bHitByte{bHit};
+	Archive.SerializeBits(&bHitByte, 1);
+	bHit = bHitByte != 0;
+
+	Archive << Mass;
+
+	Velocity.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	Direction.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	Impulse.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	bSuccess &= ALSXTGameplayTagEnumUtility::NetSerializeTag<EALSXTImpactForm>(Archive, Map, ImpactForm);
+
+	ImpactLocation.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	bSuccess &= ALSXTGameplayTagEnumUtility::NetSerializeTag<EALSXTImpactSide>(Archive, Map, ImpactSide);
+	bSuccess &= ALSXTGameplayTagEnumUtility::NetSerializeTag<EALSXTActionStrength>(Archive, Map, ImpactStrength);
+	bSuccess &= ALSXTGameplayTagEnumUtility::NetSerializeTag<EALSXTGait>(Archive, Map, ImpactGait);
+
+	DamageType.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	HitResult.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	return bSuccess;
+}
+
+bool FDoubleHitResult::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	bSuccess = true;
+	auto bSuccessLocal{true};
+
+	CollisionType.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	ImpactType.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	bSuccess &= ALSXTGameplayTagEnumUtility::NetSerializeTag<EALSXTImpactForm>(Archive, Map, ImpactForm);
+
+	ImpactLocation.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	bSuccess &= ALSXTGameplayTagEnumUtility::NetSerializeTag<EALSXTImpactSide>(Archive, Map, ImpactSide);
+
+	Strength.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	HitResult.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	OriginHitResult.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	return bSuccess;
+}
+
+bool FAttackDoubleHitResult::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	bSuccess = true;
+	auto bSuccessLocal{true};
+
+	Overlay.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	Type.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	bSuccess &= ALSXTGameplayTagEnumUtility::NetSerializeTag<EALSXTActionStrength>(Archive, Map, Strength);
+
+	Archive << BaseDamage;
+
+	DoubleHitResult.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	Archive << TimeStamp;
+
+	return bSuccess;
+}
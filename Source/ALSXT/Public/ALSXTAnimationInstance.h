@@ -143,6 +143,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (AllowPrivateAccess))
 	bool DoesOverlayObjectUseLeftHandIK{ false };
 
+	// Version of the character animation state snapshot that was last copied into this instance.
+	int32 AnimationStateSnapshotVersion{ INDEX_NONE };
+
 public:
 
 	UALSXTAnimationInstance();
@@ -175,6 +178,8 @@ protected:
 
 	virtual bool IsTurnInPlaceAllowed() override;
 
+	void RefreshAnimationStateSnapshot();
+
 	void UpdateStatusState();
 	void UpdateBreathState();
 	bool ShouldUpdateBreathState() const;
@@ -67,13 +67,14 @@ private:
 		ALSXTWeaponReadyPositionTags::None
 	};
 	
+	// Version of the character animation state snapshot that was last copied into this instance.
+	int32 AnimationStateSnapshotVersion{ INDEX_NONE };
+
+	float FirstPersonOverride{ 0.0f };
+
 	virtual void OnFirstPersonOverrideChangedEvent();
-	float FirstPersonOverride{ GetCurveValue("FirstPersonOverride") };
-	float PreviousFirstPersonOverride{ GetCurveValue("FirstPersonOverride") };
-	FTimerHandle FirstPersonOverrideHandle;
 
 public:
-	virtual void NativeBeginPlay() override;
 	virtual void NativeInitializeAnimation() override;
 
 	virtual void NativeUpdateAnimation(float DeltaTime) override;
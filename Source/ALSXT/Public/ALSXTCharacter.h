@@ -16,6 +16,7 @@
 #include "State/AlsLocomotionState.h"
 #include "Utility/ALSXTGameplayTags.h"
 #include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
 #include "Utility/ALSXTStructs.h"
 #include "State/ALSXTFootstepState.h"
 #include "State/ALSXTAimState.h"
@@ -23,6 +24,8 @@
 #include "State/ALSXTFreelookState.h"
 #include "State/ALSXTSlidingState.h"
 #include "State/ALSXTVaultingState.h"
+#include "State/ALSXTCombatState.h"
+#include "State/ALSXTAnimationStateSnapshot.h"
 #include "Interfaces/ALSXTCombatInterface.h"
 #include "Interfaces/ALSXTSeatInterface.h"
 #include "Interfaces/ALSXTCollisionInterface.h"
@@ -33,6 +36,7 @@
 class UALSXTAnimationInstance;
 class UALSXTCharacterMovementComponent;
 class UALSXTCharacterSettings;
+class UALSXTFootstepEffectsSettings;
 class USceneComponent;
 class UAlsCameraComponent;
 class UInputMappingContext;
@@ -165,6 +169,14 @@ public:
 
 	virtual void ResetPaintOnAllComponents_Implementation() const override;
 
+	virtual void NativeGetActorMass(float& Mass) override;
+
+	virtual void NativeGetActorVelocity(FVector& Velocity) override;
+
+	virtual FGameplayTag NativeGetStatus() override;
+
+	virtual FGameplayTag NativeGetCombatStance() override;
+
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character")
 	void DisableInputMovement(const bool Disable);
 
@@ -211,9 +223,17 @@ private:
 
 	// Footstep State
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings|Als Character|Footstep State", ReplicatedUsing = "OnReplicate_FootprintsState", Meta = (AllowPrivateAccess))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings|Als Character|Footstep State", Meta = (AllowPrivateAccess))
 	FALSXTFootprintsState FootprintsState;
 
+	// Only the surface types and surface alphas are replicated, the footprints state
+	// is resolved from them with the last footstep effects settings used by the character.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, ReplicatedUsing = "OnReplicate_FootprintsNetState", Meta = (AllowPrivateAccess))
+	FALSXTFootprintsNetState FootprintsNetState;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Meta = (AllowPrivateAccess))
+	TObjectPtr<UALSXTFootstepEffectsSettings> FootprintsEffectsSettings;
+
 	// Aim State
 
 public:
@@ -412,12 +432,65 @@ protected:
 
 	// Attack Trace Settings
 
-	FTimerHandle AttackTraceTimerHandle;	// Timer Handle for Attack Trace
-	FTimerDelegate AttackTraceTimerDelegate; // Delegate to bind function with parameters
+	bool bAttackTraceActive{false};
+
+	bool bHasAttackTraceSample{false};
+
+	FVector PreviousAttackTraceStart{ForceInit};
+
+	FVector PreviousAttackTraceEnd{ForceInit};
+
+	// Incremented for each attack trace, so that async results can be matched to the attack they belong to.
+	uint32 AttackTraceSerial{0};
+
+	uint32 AttackTraceRequestId{0};
+
+	// Async sweeps whose results have not arrived yet. Results that arrive after the attack trace
+	// ended are still processed, so that hits on the last frames of a swing are not lost.
+	TArray<FALSXTAttackTraceRequest> PendingAttackTraceRequests;
+
+	// Actors hit by the previous attack, used for its results that arrive after the next attack began.
+	UPROPERTY(Transient)
+	TArray<AActor*> PreviousAttackTraceLastHitActors;
+
+	int32 MaxAttackTraceSubSteps{1};
+
+	float AttackTraceSubStepDistance{0.0f};
+
+	TArray<TEnumAsByte<EObjectTypeQuery>> AttackTraceObjectTypes;
+
+	FCollisionObjectQueryParams AttackTraceObjectQueryParameters;
+
+	FTraceDelegate AttackTraceDelegate;
+
+	void SweepAttackTrace(const FVector& PreviousStart, const FVector& PreviousEnd, bool bAsync);
+
+	void OnAttackTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	void ProcessAttackTraceHits(const TArray<FHitResult>& HitResults, const FALSXTCombatAttackTraceSettings& TraceSettings,
+	                            TArray<AActor*>& HitActors);
+
+	// Hits traced by a client for the character it controls are reported to the server, which validates them against
+	// where the target was for that client. Hits traced by the server for characters it controls are applied directly.
+	void ReportAttackHit(const FAttackDoubleHitResult& Hit);
+
+	UFUNCTION(Server, Reliable)
+	void ServerReportAttackHit(const FAttackDoubleHitResult& Hit);
+
+	void ApplyAttackHit(const FAttackDoubleHitResult& Hit);
+
+	// Animation State Snapshot
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Meta = (AllowPrivateAccess))
+	FALSXTAnimationStateSnapshot AnimationStateSnapshot;
+
+	void RefreshAnimationStateSnapshot();
 
 public:
 	virtual void Tick(float DeltaTime) override;
 
+	const FALSXTAnimationStateSnapshot& GetAnimationStateSnapshot() const;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Meta = (AllowPrivateAccess))
 	FALSXTCombatAttackTraceSettings AttackTraceSettings;
 
@@ -662,6 +735,10 @@ public:
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack) override;
+
 	virtual void Crouch(bool bClientSimulation = false) override;
 
 	virtual void InputCrouch();
@@ -839,6 +916,11 @@ private:
 
 	bool TryStartVaulting(const FALSXTVaultingTraceSettings& TraceSettings);
 
+	const FALSXTVaultingProbe* FindVaultingProbe(const FALSXTVaultingTraceSettings& TraceSettings, const UPrimitiveComponent* TargetPrimitive,
+	                                             const FVector& ImpactLocation, const FVector& ApproachDirection, float LedgeHeightOffset) const;
+
+	void AddVaultingProbe(const FALSXTVaultingProbe& Probe);
+
 	UFUNCTION(Server, Reliable)
 	void ServerStartVaulting(const FALSXTVaultingParameters& Parameters);
 
@@ -868,6 +950,12 @@ private:
 
 	void StopVaulting();
 
+	static constexpr int32 VaultingProbeCacheSize{4};
+
+	FALSXTVaultingProbe VaultingProbes[VaultingProbeCacheSize];
+
+	int32 VaultingProbeIndex{0};
+
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
 	void OnVaultingEnded();
@@ -917,15 +1005,22 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "ALS|Als Character", Meta = (AutoCreateRefTerm = "NewFootprintsState"))
 	FALSXTFootprintsState ProcessNewFootprintsState(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState);
 
-	UFUNCTION(Server, Unreliable)
-	void ServerProcessNewFootprintsState(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState);
+	FALSXTFootstepSurfaceCache& GetFootstepSurfaceCache(EALSXTFootBone Foot, ETraceTypeQuery TraceChannel, float TraceDistance);
+
+	void SetFootprintsEffectsSettings(UALSXTFootstepEffectsSettings* NewFootprintsEffectsSettings);
 
 private:
-	UFUNCTION(Server, Unreliable)
-	void ServerSetFootprintsState(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState);
+	TArray<FALSXTFootstepSurfaceCache, TInlineAllocator<2>> FootstepSurfaceCaches[2];
+
+	void SetFootprintsNetState(const FALSXTFootprintsNetState& NewFootprintsNetState);
+
+	UFUNCTION(Server, Reliable)
+	void ServerSetFootprintsNetState(const FALSXTFootprintsNetState& NewFootprintsNetState);
 
 	UFUNCTION()
-	void OnReplicate_FootprintsState(const FALSXTFootprintsState& PreviousFootprintsState);
+	void OnReplicate_FootprintsNetState(const FALSXTFootprintsNetState& PreviousFootprintsNetState);
+
+	void ResolveFootprintsState();
 
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "ALS|Als Character")
@@ -1706,6 +1801,11 @@ protected:
 
 };
 
+inline const FALSXTAnimationStateSnapshot& AALSXTCharacter::GetAnimationStateSnapshot() const
+{
+	return AnimationStateSnapshot;
+}
+
 inline const FALSXTVaultingState& AALSXTCharacter::GetVaultingState() const
 {
 	return VaultingState;
@@ -1716,6 +1816,28 @@ inline const FALSXTFootprintsState& AALSXTCharacter::GetFootprintsState() const
 	return FootprintsState;
 }
 
+inline FALSXTFootstepSurfaceCache& AALSXTCharacter::GetFootstepSurfaceCache(const EALSXTFootBone Foot, const ETraceTypeQuery TraceChannel,
+                                                                             const float TraceDistance)
+{
+	auto& SurfaceCaches{FootstepSurfaceCaches[Foot == EALSXTFootBone::Left ? 0 : 1]};
+
+	auto* SurfaceCache{
+		SurfaceCaches.FindByPredicate([TraceChannel, TraceDistance](const FALSXTFootstepSurfaceCache& Cache)
+		{
+			return Cache.TraceChannel == TraceChannel && Cache.TraceDistance == TraceDistance;
+		})
+	};
+
+	if (SurfaceCache == nullptr)
+	{
+		SurfaceCache = &SurfaceCaches.AddDefaulted_GetRef();
+		SurfaceCache->TraceChannel = TraceChannel;
+		SurfaceCache->TraceDistance = TraceDistance;
+	}
+
+	return *SurfaceCache;
+}
+
 inline const FALSXTFreelookState& AALSXTCharacter::GetFreelookState() const
 {
 	return FreelookState;
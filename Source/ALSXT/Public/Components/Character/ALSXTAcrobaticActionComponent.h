@@ -9,6 +9,26 @@
 #include "ALSXTAcrobaticActionComponent.generated.h"
 
 
+// Obstacles around the character found by the acrobatic action environment probe.
+
+struct ALSXT_API FALSXTAcrobaticEnvironmentProbe
+{
+	bool bValid{false};
+
+	// Whether the character was falling when the probe was made.
+	bool bInAir{false};
+
+	uint64 FrameNumber{0};
+
+	bool bDownHit{false};
+
+	bool bForwardHit{false};
+
+	bool bLeftHit{false};
+
+	bool bRightHit{false};
+};
+
 UCLASS(Blueprintable, ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class ALSXT_API UALSXTAcrobaticActionComponent : public UActorComponent
 {
@@ -26,6 +46,8 @@ public:
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack) override;
+
 	UPROPERTY(BlueprintReadOnly, Category = "ALS|Als Character", Meta = (AllowPrivateAccess))
 	AALSXTCharacter* Character {Cast<AALSXTCharacter>(GetOwner())};
 
@@ -50,6 +72,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Settings")
 	void DetermineAcrobaticActionType(FGameplayTag& AcrobaticActionType);
 
+private:
+	FALSXTAcrobaticEnvironmentProbe EnvironmentProbe;
+
+	// Probes the environment once per air time, the result is discarded when the character lands.
+	// Probes made while not falling are only reused within the same frame.
+	const FALSXTAcrobaticEnvironmentProbe& ProbeEnvironment();
+
+	UFUNCTION()
+	void OnCharacterLanded(const FHitResult& Hit);
+
+public:
+
 	void BeginFlip();
 
 	UFUNCTION(Server, Reliable)
@@ -28,6 +28,8 @@ public:
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
 	UPROPERTY(BlueprintAssignable)
 	FOnVocalizationSignature OnVocalization;
 
@@ -58,6 +60,8 @@ public:
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack) override;
+
 	UPROPERTY(BlueprintReadOnly, Category = "ALS|Als Character", Meta = (AllowPrivateAccess))
 	AALSXTCharacter* Character{ Cast<AALSXTCharacter>(GetOwner()) };
 
@@ -178,6 +182,8 @@ public:
 	UFUNCTION(NetMulticast, Reliable)
 	void ServerPlayBreathParticle(UNiagaraSystem* NiagaraSystem);
 
+	void SpawnBreathParticle(UNiagaraSystem* NiagaraSystem) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Action Sound")
 	void SetNewSound(UObject* Sound, TArray<UObject*> PreviousAssetsReferences, int NoRepeats);
 
@@ -53,6 +53,8 @@ public:
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack) override;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Character", Meta = (AllowPrivateAccess))
 	AALSXTCharacter* Character{ Cast<AALSXTCharacter>(GetOwner()) };
 
@@ -116,6 +118,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Target Lock")
 	void RotatePlayerToTarget(FTargetHitResultEntry Target);
 
+private:
+	// Target lock candidates sorted by their angle from the center, so that switching
+	// targets is a step to the neighbor of the current target in this list.
+	TArray<FTargetHitResultEntry> TargetCandidates;
+
+	double TargetCandidatesRefreshTime{-1.0};
+
+	void RefreshTargetCandidates();
+
+	int32 FindTargetCandidateIndex(const FTargetHitResultEntry& Target) const;
+
+public:
+
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "Settings")
 	bool CanAttack();
 
@@ -220,10 +235,42 @@ private:
 
 	void StartSyncedAttack(const FGameplayTag& Overlay, const FGameplayTag& AttackType, const FGameplayTag& Stance, const FGameplayTag& Strength, const FGameplayTag& AttackMode, const float BaseDamage, const float PlayRate, const float TargetYawAngle, int Index);
 
-	FTimerHandle TargetTraceTimerHandle;
-	FTimerDelegate TargetTraceTimerDelegate;
+	// The component only ticks while an attack is active or a target is locked.
+
+	// Set when an attack starts, cleared when the primary action of the attack ends.
+	bool bAttackActive{false};
+
+	void RefreshTickEnabled();
+
+	// Target lock maintenance, runs from the tick while a target is locked. The character rotates toward the
+	// target every tick, the target is validated at TargetLockUpdateInterval.
+
+	bool bTargetLockActive{false};
+
+	float TargetLockUpdateTime{0.0f};
 
-	TArray<UMaterialInstanceDynamic*> TargetDynamicMaterials;
+	// Cached when a target is locked, so maintenance doesn't call into blueprints.
+	TArray<FGameplayTag> TargetableOverlayModesCache;
+
+	FCollisionObjectQueryParams TargetObstructionObjectQueryParameters;
+
+	bool bTargetObstructionTracePending{false};
+
+	// The target the pending obstruction trace was made for.
+	TWeakObjectPtr<AActor> TargetObstructionTraceActor;
+
+	// The character only rotates toward a target once an obstruction trace confirmed that it is visible.
+	TWeakObjectPtr<AActor> VisibleTarget;
+
+	FTraceDelegate TargetObstructionTraceDelegate;
+
+	void RefreshTargetLock(float DeltaTime);
+
+	void OnTargetObstructionTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	TWeakObjectPtr<UMeshComponent> HighlightedTargetMesh;
+
+	void SetTargetMeshHighlighted(UMeshComponent* Mesh, bool bHighlighted) const;
 
 	FTimerHandle LastTargetsTimerHandle;
 
@@ -231,9 +278,11 @@ private:
 
 	TArray<FLastTargetEntry> LastTargets;
 
-	FAttackAnimation LastAttackAnimation;
+	// Indices into the attack animations of the combat settings.
 
-	FSyncedAttackAnimation LastSyncedAttackAnimation;
+	int32 LastAttackAnimationIndex{INDEX_NONE};
+
+	int32 LastSyncedAttackAnimationIndex{INDEX_NONE};
 
 	FTimerHandle TimeSinceLastBlockTimerHandle;
 	float TimeSinceLastBlock;
@@ -241,25 +290,29 @@ private:
 	FTimerHandle ConsecutiveHitsTimerHandle;
 	int ConsecutiveHits;
 
+	UAnimMontage* GetAttackMontageByIndex(int32 Index);
+
+	UAnimMontage* GetSyncedAttackMontageByIndex(int32 Index);
+
 	UFUNCTION(Server, Reliable)
-	void ServerStartAttack(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
+	void ServerStartAttack(int32 AttackAnimationIndex, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
 	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStartAttack(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
+	void MulticastStartAttack(int32 AttackAnimationIndex, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
-	void StartAttackImplementation(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
+	void StartAttackImplementation(int32 AttackAnimationIndex, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
 	void RefreshAttack(float DeltaTime);
 
 	void RefreshAttackPhysics(float DeltaTime);
 
 	UFUNCTION(Server, Reliable)
-	void ServerStartSyncedAttack(UAnimMontage* Montage, int32 Index, float PlayRate, float StartYawAngle, float TargetYawAngle);
+	void ServerStartSyncedAttack(int32 Index, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
 	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStartSyncedAttack(UAnimMontage* Montage, int32 Index, float PlayRate, float StartYawAngle, float TargetYawAngle);
+	void MulticastStartSyncedAttack(int32 Index, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
-	void StartSyncedAttackImplementation(UAnimMontage* Montage, int32 Index, float PlayRate, float StartYawAngle, float TargetYawAngle);
+	void StartSyncedAttackImplementation(int32 Index, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
 	void RefreshSyncedAttack(float DeltaTime);
 
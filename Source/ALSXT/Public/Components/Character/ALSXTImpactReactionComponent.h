@@ -31,6 +31,8 @@ public:
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -99,6 +101,8 @@ protected:
 public:	
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack) override;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Character", Meta = (AllowPrivateAccess))
 	AALSXTCharacter* Character{ Cast<AALSXTCharacter>(GetOwner()) };
 
@@ -592,6 +596,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Impact Reaction")
 	void AttackReaction(FAttackDoubleHitResult Hit);
 
+	// Called on the server with a hit on this character traced by the attacker. Hits traced by a remote client
+	// are first validated against where this character was at the time of the hit for that client.
+	void ReceiveAttackHit(const ACharacter& Attacker, const FAttackDoubleHitResult& Hit);
+
 	UFUNCTION(BlueprintCallable, Category = "Impact Reaction")
 	void SyncedAttackReaction(int Index);
 
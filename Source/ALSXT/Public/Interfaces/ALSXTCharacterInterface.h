@@ -29,6 +29,9 @@ public:
   UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "ALSXTCharacter Interface")
   UPARAM(meta = (Categories = "Als.Status")) FGameplayTag GetStatus();
 
+  // Native counterpart of GetStatus(), called by ALSXT_EXECUTE_NATIVE when the event is not implemented in Blueprint.
+  virtual FGameplayTag NativeGetStatus() { return FGameplayTag::EmptyTag; }
+
   UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "ALSXTCharacter Interface")
   FALSXTStatusState GetStatusState();
 
@@ -86,6 +89,9 @@ public:
   UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "Impact Reaction")
   UPARAM(meta = (Categories = "Als.Combat Stance")) FGameplayTag GetCombatStance();
 
+  // Native counterpart of GetCombatStance(), called by ALSXT_EXECUTE_NATIVE when the event is not implemented in Blueprint.
+  virtual FGameplayTag NativeGetCombatStance() { return FGameplayTag::EmptyTag; }
+
   UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "Impact Reaction")
   void AnticipationReaction(const FGameplayTag& Velocity, const FGameplayTag& Side, const FGameplayTag& Form, FVector AnticipationPoint);
 
@@ -28,6 +28,13 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "Collision Interface|Parameters")
 	void GetActorVelocity(FVector& Velocity);
 
+	// Native counterparts of GetActorMass() and GetActorVelocity(), called by ALSXT_EXECUTE_NATIVE when the events are
+	// not implemented in Blueprint. Like the unimplemented events, they leave the values unchanged by default.
+
+	virtual void NativeGetActorMass(float& Mass) {}
+
+	virtual void NativeGetActorVelocity(FVector& Velocity) {}
+
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "Collision Interface|Parameters")
 	void GetActorThreatPoint(FVector& ThreatPoint);
 
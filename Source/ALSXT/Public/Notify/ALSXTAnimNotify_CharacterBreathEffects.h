@@ -21,6 +21,9 @@ public:
 	virtual void Notify(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
 	const FAnimNotifyEventReference& EventReference) override;
 
+	// Executes the effects of the notify, either deferred by the effect command subsystem or immediately.
+	void SpawnEffects(USkeletalMeshComponent* Mesh);
+
 	/** Option to override Setting set in Character */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Editor Preview")
 	USoundBase* PreviewSound;
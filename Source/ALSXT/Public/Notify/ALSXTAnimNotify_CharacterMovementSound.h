@@ -20,6 +20,9 @@ public:
 	virtual void Notify(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
 	const FAnimNotifyEventReference& EventReference) override;
 
+	// Executes the effects of the notify, either deferred by the effect command subsystem or immediately.
+	void SpawnEffects(USkeletalMeshComponent* Mesh);
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	FGameplayTag MovementType{FGameplayTag::EmptyTag};
 
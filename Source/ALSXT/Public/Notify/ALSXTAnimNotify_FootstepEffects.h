@@ -169,6 +169,9 @@ struct ALSXT_API FALSXTFootstepEffectSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Particle System")
 	FRotator ParticleSystemFootRightRotationOffset{ForceInit};
+
+	// Copies the transfer and decal values into the footprint state phase, except for the surface type.
+	void ApplyToFootprintStatePhase(FALSXTFootprintStatePhase& Phase) const;
 };
 
 UCLASS(Blueprintable, BlueprintType)
@@ -195,6 +198,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float SurfaceTraceDistance{50.0f};
 
+	// Footsteps reuse the last surface resolved under the foot while the character stands on the same floor plane
+	// and the footstep is within this distance of the previous footstep of that foot, so it should be longer
+	// than a stride. Zero disables the reuse.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float SurfaceCacheDistance{300.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, DisplayName = "Foot Left Y Axis")
 	FVector FootLeftYAxis{0.0f, 0.0f, 1.0f};
 
@@ -209,6 +218,26 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ForceInlineRow))
 	TMap<TEnumAsByte<EPhysicalSurface>, FALSXTFootstepEffectSettings> Effects;
+
+private:
+	// Effect settings indexed by surface type, built when the asset is loaded or edited.
+	TArray<const FALSXTFootstepEffectSettings*, TFixedAllocator<SurfaceType_Max>> EffectSettingsBySurface;
+
+public:
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Must be called after the effects are changed at runtime.
+	void RebuildEffectSettingsBySurface();
+
+	// Falls back to the first effect settings if there are none for the surface.
+	const FALSXTFootstepEffectSettings* FindEffectSettings(EPhysicalSurface SurfaceType) const;
+
+	// Appends the sounds, decal materials and particle systems of all surfaces.
+	void GetEffectAssetPaths(TArray<FSoftObjectPath>& AssetPaths) const;
 };
 
 UCLASS(DisplayName = "ALSXT Footstep Effects Animation Notify",
@@ -227,6 +256,9 @@ public:
 	virtual void Notify(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
 	const FAnimNotifyEventReference& EventReference) override;
 
+	// Executes the effects of the notify, either deferred by the effect command subsystem or immediately.
+	void SpawnEffects(USkeletalMeshComponent* Mesh);
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
 	UALSXTFootstepEffectsSettings* FootstepEffectsSettings;
 
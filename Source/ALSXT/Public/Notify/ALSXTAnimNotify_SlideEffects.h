@@ -137,6 +137,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float SurfaceTraceDistance{50.0f};
 
+	// Slides reuse the last surface resolved under the foot while the character stands on the same floor plane
+	// and the foot is within this distance of the previous slide effect of that foot. Zero disables the reuse.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float SurfaceCacheDistance{300.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, DisplayName = "Foot Left Y Axis")
 	FVector FootLeftYAxis {0.0f, 0.0f, 1.0f};
 
@@ -151,6 +156,26 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ForceInlineRow))
 	TMap<TEnumAsByte<EPhysicalSurface>, FALSXTSlideEffectSettings> Effects;
+
+private:
+	// Effect settings indexed by surface type, built when the asset is loaded or edited.
+	TArray<const FALSXTSlideEffectSettings*, TFixedAllocator<SurfaceType_Max>> EffectSettingsBySurface;
+
+public:
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Must be called after the effects are changed at runtime.
+	void RebuildEffectSettingsBySurface();
+
+	// Falls back to the first effect settings if there are none for the surface.
+	const FALSXTSlideEffectSettings* FindEffectSettings(EPhysicalSurface SurfaceType) const;
+
+	// Appends the sounds, decal materials and particle systems of all surfaces.
+	void GetEffectAssetPaths(TArray<FSoftObjectPath>& AssetPaths) const;
 };
 
 /**
@@ -168,6 +193,9 @@ public:
 	virtual void Notify(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
 	const FAnimNotifyEventReference& EventReference) override;
 
+	// Executes the effects of the notify, either deferred by the effect command subsystem or immediately.
+	void SpawnEffects(USkeletalMeshComponent* Mesh);
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
 	UALSXTSlideEffectsSettings* SlideEffectsSettings;
 
@@ -194,5 +222,4 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (AllowPrivateAccess))
 	FHitResult HitResult;
-	
 };
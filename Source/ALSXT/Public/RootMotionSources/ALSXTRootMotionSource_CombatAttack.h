@@ -3,6 +3,7 @@
 #include "GameFramework/RootMotionSource.h"
 #include "Settings/ALSXTCombatSettings.h"
 #include "State/ALSXTCombatState.h"
+#include "Utility/ALSXTRootMotionCurveTable.h"
 #include "ALSXTRootMotionSource_CombatAttack.generated.h"
 
 class UALSXTCombatAttackSettings;
@@ -37,9 +38,16 @@ public:
 	UPROPERTY(Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float AttackHeight{0.0f};
 
+	// Baked from the attack animation curves, shared between clones of this root motion source.
+	TSharedPtr<const FALSXTRootMotionCurveTable> CurveTable;
+
 public:
 	FALSXTRootMotionSource_CombatAttack();
 
+	void CaptureCombatState(const ACharacter& Character);
+
+	void BakeCurveTable();
+
 	virtual FRootMotionSource* Clone() const override;
 
 	virtual bool Matches(const FRootMotionSource* Other) const override;
@@ -3,6 +3,7 @@
 #include "GameFramework/RootMotionSource.h"
 #include "Settings/ALSXTImpactReactionSettings.h"
 #include "State/ALSXTImpactReactionState.h"
+#include "Utility/ALSXTRootMotionCurveTable.h"
 #include "ALSXTRootMotionSource_ImpactReaction.generated.h"
 
 class UALSXTImpactReactionSettings;
@@ -37,9 +38,16 @@ public:
 	UPROPERTY(Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float ImpactHeight{0.0f};
 
+	// Baked from the impact reaction animation curves, shared between clones of this root motion source.
+	TSharedPtr<const FALSXTRootMotionCurveTable> CurveTable;
+
 public:
 	FALSXTRootMotionSource_ImpactReaction();
 
+	void CaptureImpactReactionState(const ACharacter& Character);
+
+	void BakeCurveTable();
+
 	virtual FRootMotionSource* Clone() const override;
 
 	virtual bool Matches(const FRootMotionSource* Other) const override;
@@ -2,6 +2,7 @@
 
 #include "GameFramework/RootMotionSource.h"
 #include "State/ALSXTVaultingState.h"
+#include "Utility/ALSXTRootMotionCurveTable.h"
 #include "ALSXTRootMotionSource_Vaulting.generated.h"
 
 class UALSXTVaultingSettings;
@@ -18,6 +19,12 @@ public:
 	UPROPERTY()
 	FALSXTVaultingState VaultingState;
 
+	// Index of the played animation in the vaulting settings animations. Replicated instead of the
+	// animation itself, which is resolved from the vaulting settings on the receiving side. INDEX_NONE
+	// if the animation is not in the vaulting settings, in which case the montage is replicated in full.
+	UPROPERTY()
+	int32 VaultAnimationIndex{INDEX_NONE};
+
 	UPROPERTY()
 	TWeakObjectPtr<UPrimitiveComponent> TargetPrimitive;
 
@@ -39,9 +46,16 @@ public:
 	UPROPERTY(Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float VaultingHeight{0.0f};
 
+	// Baked from the vault animation curves, shared between clones of this root motion source.
+	TSharedPtr<const FALSXTRootMotionCurveTable> CurveTable;
+
 public:
 	FALSXTRootMotionSource_Vaulting();
 
+	void BakeCurveTable();
+
+	void ResolveVaultAnimation();
+
 	virtual FRootMotionSource* Clone() const override;
 
 	virtual bool Matches(const FRootMotionSource* Other) const override;
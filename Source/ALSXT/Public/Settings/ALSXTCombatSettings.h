@@ -50,6 +50,28 @@ struct ALSXT_API FALSXTCombatParameters
 	float PlayRate{ 0.0f };
 };
 
+// Attack type, stance and strength an attack animation is selected by. The overlay mode is
+// not part of the key, since combat settings are already selected per overlay mode.
+
+struct ALSXT_API FALSXTAttackAnimationKey
+{
+	FGameplayTag AttackType;
+
+	FGameplayTag Stance;
+
+	FGameplayTag Strength;
+
+	bool operator==(const FALSXTAttackAnimationKey& Other) const
+	{
+		return AttackType == Other.AttackType && Stance == Other.Stance && Strength == Other.Strength;
+	}
+
+	friend uint32 GetTypeHash(const FALSXTAttackAnimationKey& Key)
+	{
+		return HashCombineFast(HashCombineFast(GetTypeHash(Key.AttackType), GetTypeHash(Key.Stance)), GetTypeHash(Key.Strength));
+	}
+};
+
 UCLASS(Blueprintable, BlueprintType)
 class ALSXT_API UALSXTCombatSettings : public UDataAsset
 {
@@ -77,7 +99,28 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Target Lock", Meta = (Units = "cm", AllowPrivateAccess))
 	float MoveToTargetMaxDistance { 900.0f };
 
+private:
+	// Indices of the animations matching each key of the animations, built when the asset is loaded or edited.
+
+	TMap<FALSXTAttackAnimationKey, TArray<int32>> AttackAnimationIndices;
+
+	TMap<FALSXTAttackAnimationKey, TArray<int32>> SyncedAttackAnimationIndices;
+
 public:
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Must be called after the attack animations are changed at runtime.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Combat Settings")
+	void RebuildAnimationIndices();
+
+	const TArray<int32>& GetAttackAnimationIndices(const FALSXTAttackAnimationKey& Key) const;
+
+	const TArray<int32>& GetSyncedAttackAnimationIndices(const FALSXTAttackAnimationKey& Key) const;
+
 	float CalculateStartTime(FVector2D ReferenceHeight, FVector2D StartTime, float AttackHeight) const;
 
 	float CalculatePlayRate(FVector2D ReferenceHeight, FVector2D PlayRate, float AttackHeight) const;
@@ -167,6 +210,11 @@ struct ALSXT_API FALSXTGeneralCombatSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
 	FName HighlightMaterialParameterName { "Highlight" };
 
+	// If set, the locked target is highlighted through this custom primitive data index instead of the
+	// highlight material parameter, so the target's materials don't need dynamic material instances.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = -1, AllowPrivateAccess))
+	int32 HighlightCustomPrimitiveDataIndex { INDEX_NONE };
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
 	FVector	TraceAreaHalfSize { 650.0f, 600.0f, 150.0f };
 
@@ -176,6 +224,14 @@ struct ALSXT_API FALSXTGeneralCombatSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings|Target Lock", Meta = (Units = "cm", AllowPrivateAccess))
 	float MaxLockDistance { 1000.0f };
 
+	// How often the sorted list of target lock candidates is rebuilt while aiming.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings|Target Lock", Meta = (ClampMin = 0, ForceUnits = "s", AllowPrivateAccess))
+	float TargetCandidatesRefreshInterval { 0.2f };
+
+	// How often the locked target is checked and the player rotated towards it. Zero updates every frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings|Target Lock", Meta = (ClampMin = 0, ForceUnits = "s", AllowPrivateAccess))
+	float TargetLockUpdateInterval { 0.0333f };
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings|Target Lock", Meta = (AllowPrivateAccess))
 	bool UnlockWhenTargetIsObstructed { true };
 
@@ -188,6 +244,14 @@ struct ALSXT_API FALSXTGeneralCombatSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
 	TArray<TEnumAsByte<EObjectTypeQuery>> AttackTraceObjectTypes;
 
+	// The volume swept by the attack between two frames is covered by sweeping points spread along the attack
+	// trace, spaced by the sub-step distance. Spacing them no further apart than the trace diameter leaves no gaps.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 1, ClampMax = 16))
+	int32 MaxAttackTraceSubSteps{4};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 1, ForceUnits = "cm"))
+	float AttackTraceSubStepDistance{15.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings|Debug", Meta = (AllowPrivateAccess))
 	bool DebugMode {false};
 
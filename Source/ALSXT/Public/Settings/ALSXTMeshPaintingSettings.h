@@ -3,6 +3,7 @@
 #include "Utility/ALSXTStructs.h"
 #include "Engine/DataAsset.h"
 #include "Engine/EngineTypes.h"
+#include "Utility/ALSXTEnums.h"
 #include "ALSXTMeshPaintingSettings.generated.h"
 
 USTRUCT(BlueprintType)
@@ -59,8 +60,39 @@ struct ALSXT_API FALSXTGeneralMeshPaintingSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPreserveRatio))
 	FVector2D RenderTargetSize{ 1024, 1024 };
+
+	bool IsPaintTypeEnabled(EALSXTMeshPaintType PaintType) const;
 };
 
+inline bool FALSXTGeneralMeshPaintingSettings::IsPaintTypeEnabled(const EALSXTMeshPaintType PaintType) const
+{
+	if (!bEnableMeshPainting)
+	{
+		return false;
+	}
+
+	switch (PaintType)
+	{
+	case EALSXTMeshPaintType::BloodDamage:
+		return bEnableBloodDamage;
+
+	case EALSXTMeshPaintType::SurfaceDamage:
+		return bEnableSurfaceDamage;
+
+	case EALSXTMeshPaintType::BackSpatter:
+		return bEnableBackspatter;
+
+	case EALSXTMeshPaintType::Saturation:
+		return bEnableSaturation;
+
+	case EALSXTMeshPaintType::Burn:
+		return bEnableBurnDamage;
+
+	default:
+		return false;
+	}
+}
+
 USTRUCT(BlueprintType)
 struct ALSXT_API FALSXTGlobalGeneralMeshPaintingSettings
 {
@@ -144,4 +144,14 @@ struct ALSXT_API FALSXTGeneralVaultingSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Actions|Vaulting|Obstacle Trace")
 	TArray<TEnumAsByte<EObjectTypeQuery>> VaultingTraceObjectTypes;
+
+	// How long the result of the ledge traces is reused for repeated attempts at the same ledge. Zero disables the cache.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Actions|Vaulting|Obstacle Trace", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float ProbeCacheLifetime{0.5f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Actions|Vaulting|Obstacle Trace", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float ProbeCacheLocationTolerance{10.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Actions|Vaulting|Obstacle Trace", Meta = (ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
+	float ProbeCacheAngleTolerance{15.0f};
 };
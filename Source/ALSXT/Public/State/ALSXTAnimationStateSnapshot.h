@@ -0,0 +1,103 @@
+#pragma once
+
+#include "NativeGameplayTags.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/ALSXTGameplayTags.h"
+#include "ALSXTAnimationStateSnapshot.generated.h"
+
+// Tags read by the ALSXT animation instances, refreshed once per character tick. Version is
+// only incremented when one of the tags actually changes, so animation instances can skip the copy.
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTAnimationStateSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Version{ 0 };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag Overlay{ AlsOverlayModeTags::Default };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag Freelooking{ ALSXTFreelookingTags::False };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag Sex{ ALSXTSexTags::Male };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag DefensiveMode{ ALSXTDefensiveModeTags::None };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag LocomotionVariant{ ALSXTLocomotionVariantTags::Default };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag Injury{ ALSXTInjuryTags::None };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag CombatStance{ ALSXTCombatStanceTags::Neutral };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag WeaponFirearmStance{ ALSXTWeaponFirearmStanceTags::Regular };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag WeaponReadyPosition{ ALSXTWeaponReadyPositionTags::None };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag StationaryMode{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag HoldingBreath{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag DesiredHoldingBreath{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag PhysicalAnimationMode{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag Gesture{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag GestureHand{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag ReloadingType{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag ForegripPosition{ ALSXTForegripPositionTags::Default };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag FirearmFingerAction{ ALSXTFirearmFingerActionTags::None };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag FirearmFingerActionHand{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag WeaponCarryPosition{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag FirearmSightLocation{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag VaultType{ FGameplayTag::EmptyTag };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGameplayTag WeaponObstruction{ FGameplayTag::EmptyTag };
+
+	// Compares the tags only, the version is not part of the state.
+	bool HasSameTags(const FALSXTAnimationStateSnapshot& Other) const
+	{
+		return Overlay == Other.Overlay && Freelooking == Other.Freelooking && Sex == Other.Sex &&
+			DefensiveMode == Other.DefensiveMode && LocomotionVariant == Other.LocomotionVariant &&
+			Injury == Other.Injury && CombatStance == Other.CombatStance &&
+			WeaponFirearmStance == Other.WeaponFirearmStance && WeaponReadyPosition == Other.WeaponReadyPosition &&
+			StationaryMode == Other.StationaryMode && HoldingBreath == Other.HoldingBreath &&
+			DesiredHoldingBreath == Other.DesiredHoldingBreath && PhysicalAnimationMode == Other.PhysicalAnimationMode &&
+			Gesture == Other.Gesture && GestureHand == Other.GestureHand && ReloadingType == Other.ReloadingType &&
+			ForegripPosition == Other.ForegripPosition && FirearmFingerAction == Other.FirearmFingerAction &&
+			FirearmFingerActionHand == Other.FirearmFingerActionHand && WeaponCarryPosition == Other.WeaponCarryPosition &&
+			FirearmSightLocation == Other.FirearmSightLocation && VaultType == Other.VaultType &&
+			WeaponObstruction == Other.WeaponObstruction;
+	}
+};
@@ -12,3 +12,18 @@ struct ALSXT_API FALSXTCombatState
 	FALSXTCombatParameters CombatParameters;
 };
 
+
+// An attack trace submitted as an async sweep, with the trace settings of the frame it was sampled in.
+
+struct ALSXT_API FALSXTAttackTraceRequest
+{
+	uint32 Id{0};
+
+	// The attack the request belongs to.
+	uint32 Serial{0};
+
+	// Sweeps submitted for the request whose results have not arrived yet.
+	int32 RemainingSweepCount{0};
+
+	FALSXTCombatAttackTraceSettings TraceSettings;
+};
@@ -21,6 +21,26 @@ enum class EALSXTFootprintPhase : uint8
 	Previous,
 };
 
+// Last surface resolved under a foot, reused by footstep effects while the character stays on the same floor.
+// Kept per trace channel and distance, so effects with different trace settings don't share it.
+
+struct ALSXT_API FALSXTFootstepSurfaceCache
+{
+	TEnumAsByte<ETraceTypeQuery> TraceChannel{TraceTypeQuery1};
+
+	float TraceDistance{0.0f};
+
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+
+	TWeakObjectPtr<UPhysicalMaterial> PhysicalMaterial;
+
+	FVector ImpactPoint{ForceInit};
+
+	FVector ImpactNormal{ForceInit};
+
+	bool bValid{false};
+};
+
 USTRUCT(BlueprintType)
 struct ALSXT_API FALSXTFootprintStatePhase
 {
@@ -125,6 +145,82 @@ struct ALSXT_API FALSXTFootprintsState
 
 };
 
+// Replicated form of the footprint state of a foot. The rest of the footprint
+// state is resolved from the footstep effects settings by the surface types.
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTFootprintNetState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TEnumAsByte<EPhysicalSurface> CurrentSurfaceType{SurfaceType_Default};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TEnumAsByte<EPhysicalSurface> PreviousSurfaceType{SurfaceType_Default};
+
+	// Foot surface alpha quantized to a byte.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	uint8 FootSurfaceAlpha{0};
+
+	void SetFootSurfaceAlpha(const float Alpha)
+	{
+		FootSurfaceAlpha = static_cast<uint8>(FMath::RoundToInt(UAlsMath::Clamp01(Alpha) * MAX_uint8));
+	}
+
+	float GetFootSurfaceAlpha() const
+	{
+		return FootSurfaceAlpha / static_cast<float>(MAX_uint8);
+	}
+
+	bool operator==(const FALSXTFootprintNetState& Other) const
+	{
+		return CurrentSurfaceType == Other.CurrentSurfaceType && PreviousSurfaceType == Other.PreviousSurfaceType &&
+		       FootSurfaceAlpha == Other.FootSurfaceAlpha;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTFootprintsNetState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FALSXTFootprintNetState Left;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FALSXTFootprintNetState Right;
+
+	bool operator==(const FALSXTFootprintsNetState& Other) const
+	{
+		return Left == Other.Left && Right == Other.Right;
+	}
+
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+	{
+		Archive << Left.CurrentSurfaceType;
+		Archive << Left.PreviousSurfaceType;
+		Archive << Left.FootSurfaceAlpha;
+
+		Archive << Right.CurrentSurfaceType;
+		Archive << Right.PreviousSurfaceType;
+		Archive << Right.FootSurfaceAlpha;
+
+		bSuccess = true;
+		return true;
+	}
+};
+
+template <>
+struct TStructOpsTypeTraits<FALSXTFootprintsNetState> : public TStructOpsTypeTraitsBase2<FALSXTFootprintsNetState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true
+	};
+};
+
 USTRUCT(BlueprintType)
 struct ALSXT_API FALSXTFootwearDetails
 {
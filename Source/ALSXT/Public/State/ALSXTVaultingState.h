@@ -14,3 +14,24 @@ struct ALSXT_API FALSXTVaultingState
 	FALSXTVaultingParameters VaultingParameters;
 };
 
+
+// Result of the ledge traces of a single vaulting attempt, stored relative to the target primitive.
+
+struct ALSXT_API FALSXTVaultingProbe
+{
+	const FALSXTVaultingTraceSettings* TraceSettings{nullptr};
+
+	TWeakObjectPtr<UPrimitiveComponent> TargetPrimitive;
+
+	FVector RelativeImpactLocation{ForceInit};
+
+	FVector RelativeLedgeLocation{ForceInit};
+
+	FVector ApproachDirection{ForceInit};
+
+	float LedgeHeightOffset{0.0f};
+
+	double Time{0.0};
+
+	bool bSuccessful{false};
+};
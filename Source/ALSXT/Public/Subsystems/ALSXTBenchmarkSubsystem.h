@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "ALSXTBenchmarkSubsystem.generated.h"
+
+class AALSXTCharacter;
+
+// Headless benchmark driver, only created when the game is launched with -ALSXTBenchmark. Spawns characters on a ring
+// course around the first player start, drives them through a scripted cycle of idle, walk, sprint, slide, vault and
+// attack phases, and samples frame cost, the ALSXT stat timings and counters every frame. The samples are written as
+// CSV to the profiling directory once the run ends, after which the game exits with a nonzero status if the run
+// failed, so that a pipeline can act on it. For example:
+//
+// UnrealEditor-Cmd Project.uproject BenchmarkMap -game -nullrhi -unattended -ALSXTBenchmark
+// -ALSXTBenchmarkCharacters=100 -ALSXTBenchmarkDuration=60 -ALSXTBenchmarkCharacterClass=/Game/Path/To/BP_Character.BP_Character_C
+//
+// Run as a listen server (BenchmarkMap?listen) to also sample replicated bytes, and add -ini:Engine:[ConsoleVariables]:
+// alsxt.Net.Accounting=1 to log the ALSXT network accounting report at the end of the run and fail the run when it is
+// over alsxt.Net.CharacterBudget.
+
+UCLASS()
+class ALSXT_API UALSXTBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 MaxCharacters{500};
+
+	static constexpr float PhaseDuration{4.0f};
+
+	// Distance between neighboring characters on the ring course, close enough for them to bump into each other.
+	static constexpr float CharacterSpacing{150.0f};
+
+	static constexpr float MinCourseRadius{500.0f};
+
+	// Exit status when no character could be spawned or the samples could not be written.
+	static constexpr uint8 FailedExitStatus{1};
+
+	// Exit status when the network accounting report is over alsxt.Net.CharacterBudget.
+	static constexpr uint8 OverNetBudgetExitStatus{2};
+
+private:
+	enum class EBenchmarkPhase : uint8
+	{
+		Idle,
+		Walk,
+		Sprint,
+		Slide,
+		Vault,
+		Attack,
+		Count
+	};
+
+	struct FBenchmarkSample
+	{
+		double Time{0.0};
+
+		float DeltaTime{0.0f};
+
+		uint64 UsedPhysicalMemory{0};
+
+		// The counters below are running totals since the start of the run.
+
+		uint32 SpawnedEffectCount{0};
+
+		uint32 CulledEffectCount{0};
+
+		uint32 ExecutedCommandCount{0};
+
+		uint32 DroppedCommandCount{0};
+
+		uint32 ReplicatedBytes{0};
+
+		// Index of the first value of this sample in BenchmarkCounterValues.
+		int32 BenchmarkCounterIndex{0};
+	};
+
+	TArray<TWeakObjectPtr<AALSXTCharacter>> Characters;
+
+	// Per character, the phase of the previous tick, so that one shot actions are only triggered on phase change.
+	TArray<EBenchmarkPhase> CharacterPhases;
+
+	TArray<FBenchmarkSample> Samples;
+
+	// Running totals of each ALSXT benchmark counter, in the order of ALSXTStats::GetBenchmarkCounters(), per sample.
+	TArray<uint64> BenchmarkCounterValues;
+
+	FVector CourseCenter{ForceInit};
+
+	float CourseRadius{MinCourseRadius};
+
+	double StartTime{0.0};
+
+	double Duration{60.0};
+
+	int32 CharacterCount{1};
+
+	bool bFinished{false};
+
+public:
+	static bool IsBenchmarkEnabled();
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void OnWorldBeginPlay(UWorld& World) override;
+
+	virtual TStatId GetStatId() const override;
+
+	virtual void Tick(float DeltaTime) override;
+
+private:
+	void SpawnCharacters(UWorld& World);
+
+	void DriveCharacter(AALSXTCharacter& Character, int32 CharacterIndex, double Time);
+
+	void RecordSample(float DeltaTime);
+
+	void FinishBenchmark();
+
+	static void ExitBenchmark(uint8 ExitStatus);
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "ALSXTEffectCommandSubsystem.generated.h"
+
+class UAnimNotify;
+class USkeletalMeshComponent;
+
+enum class EALSXTEffectCommandType : uint8
+{
+	Footstep,
+	Slide,
+	CharacterBreath,
+	CharacterMovementSound
+};
+
+// Buffer of effects requested by animation notifies, so that traces and spawns are not executed inside animation
+// notify dispatch. The buffer is processed once per frame, grouped by effect type. Commands of the same type
+// recorded by the same notify for the same mesh in the same frame are merged, and at most a fixed number of commands are executed
+// per frame, the rest being carried over to the next frame unless they are too old.
+//
+// Only created for game worlds, animation previews execute their effects immediately.
+
+UCLASS()
+class ALSXT_API UALSXTEffectCommandSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 MaxCommandsPerFrame{32};
+
+	// Commands that could not be executed within this number of frames are dropped.
+	static constexpr uint64 MaxCommandAge{2};
+
+private:
+	struct FEffectCommand
+	{
+		TWeakObjectPtr<UAnimNotify> Notify;
+
+		TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+
+		uint64 Frame{0};
+
+		EALSXTEffectCommandType Type{EALSXTEffectCommandType::Footstep};
+
+		// Distinguishes commands of the same type that should not be merged, such as the left and right foot.
+		uint8 Variant{0};
+	};
+
+	TArray<FEffectCommand> Commands;
+
+	TArray<FEffectCommand> ExecutingCommands;
+
+	uint32 ExecutedCommandCount{0};
+
+	uint32 MergedCommandCount{0};
+
+	uint32 DroppedCommandCount{0};
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual TStatId GetStatId() const override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	void RecordCommand(EALSXTEffectCommandType Type, uint8 Variant, UAnimNotify* Notify, USkeletalMeshComponent* Mesh);
+
+	uint32 GetExecutedCommandCount() const;
+
+	uint32 GetMergedCommandCount() const;
+
+	uint32 GetDroppedCommandCount() const;
+
+private:
+	static void ExecuteCommand(const FEffectCommand& Command);
+};
+
+inline uint32 UALSXTEffectCommandSubsystem::GetExecutedCommandCount() const
+{
+	return ExecutedCommandCount;
+}
+
+inline uint32 UALSXTEffectCommandSubsystem::GetMergedCommandCount() const
+{
+	return MergedCommandCount;
+}
+
+inline uint32 UALSXTEffectCommandSubsystem::GetDroppedCommandCount() const
+{
+	return DroppedCommandCount;
+}
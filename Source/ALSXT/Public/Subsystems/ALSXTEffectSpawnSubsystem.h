@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Utility/ALSXTEnums.h"
+#include "ALSXTEffectSpawnSubsystem.generated.h"
+
+class UNiagaraComponent;
+class UNiagaraSystem;
+class UPrimitiveComponent;
+
+USTRUCT()
+struct ALSXT_API FALSXTEffectSpawnTypeSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float CullDistance{3000.0f};
+
+	// Past this distance, effects are only spawned if their source component was recently rendered.
+	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float SignificanceDistance{1500.0f};
+
+	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0))
+	int32 MaxInstances{8};
+};
+
+// Single entry point for the particle effects spawned by ALSXT. Effects are spawned from the Niagara component
+// pool, and are culled before spawning when they are too far from every local view, when they are past the
+// significance distance and their source was not recently rendered, or when their type is at its instance cap.
+// The limits of each effect type can be overridden in the [/Script/ALSXT.ALSXTEffectSpawnSubsystem] section of the game config.
+
+UCLASS(Config = Game)
+class ALSXT_API UALSXTEffectSpawnSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config, EditAnywhere, Category = "Settings")
+	FALSXTEffectSpawnTypeSettings FootstepEffectSettings{3000.0f, 1500.0f, 24};
+
+	UPROPERTY(Config, EditAnywhere, Category = "Settings")
+	FALSXTEffectSpawnTypeSettings SlideEffectSettings{3000.0f, 1500.0f, 8};
+
+	UPROPERTY(Config, EditAnywhere, Category = "Settings")
+	FALSXTEffectSpawnTypeSettings BreathEffectSettings{1500.0f, 750.0f, 8};
+
+private:
+	struct FActiveEffect
+	{
+		TWeakObjectPtr<UNiagaraComponent> Component;
+
+		// Pooled components may be reused for another system once they complete.
+		TObjectKey<UNiagaraSystem> System;
+	};
+
+	TArray<FActiveEffect> ActiveEffects[static_cast<uint8>(EALSXTEffectSpawnType::Count)];
+
+	uint32 SpawnedEffectCounts[static_cast<uint8>(EALSXTEffectSpawnType::Count)]{};
+
+	uint32 CulledEffectCounts[static_cast<uint8>(EALSXTEffectSpawnType::Count)]{};
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+
+	uint64 ViewLocationsFrame{0};
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void Deinitialize() override;
+
+	const FALSXTEffectSpawnTypeSettings& GetEffectTypeSettings(EALSXTEffectSpawnType Type) const;
+
+	UNiagaraComponent* SpawnSystemAtLocation(EALSXTEffectSpawnType Type, UNiagaraSystem* System, const FVector& Location,
+	                                         const FRotator& Rotation, const FVector& Scale = FVector::OneVector,
+	                                         const UPrimitiveComponent* SourceComponent = nullptr);
+
+	// The attach component is also used as the source component if it is a primitive component.
+	UNiagaraComponent* SpawnSystemAttached(EALSXTEffectSpawnType Type, UNiagaraSystem* System, USceneComponent* AttachComponent,
+	                                       FName AttachPointName, const FVector& Location, const FRotator& Rotation,
+	                                       const FVector& Scale, EAttachLocation::Type LocationType);
+
+	uint32 GetSpawnedEffectCount(EALSXTEffectSpawnType Type) const;
+
+	uint32 GetCulledEffectCount(EALSXTEffectSpawnType Type) const;
+
+private:
+	bool ShouldSpawnEffect(EALSXTEffectSpawnType Type, const UNiagaraSystem* System, const FVector& Location,
+	                       const UPrimitiveComponent* SourceComponent);
+
+	void RefreshViewLocations();
+
+	void AddActiveEffect(EALSXTEffectSpawnType Type, UNiagaraComponent* Component);
+};
+
+inline uint32 UALSXTEffectSpawnSubsystem::GetSpawnedEffectCount(const EALSXTEffectSpawnType Type) const
+{
+	return SpawnedEffectCounts[static_cast<uint8>(Type)];
+}
+
+inline uint32 UALSXTEffectSpawnSubsystem::GetCulledEffectCount(const EALSXTEffectSpawnType Type) const
+{
+	return CulledEffectCounts[static_cast<uint8>(Type)];
+}
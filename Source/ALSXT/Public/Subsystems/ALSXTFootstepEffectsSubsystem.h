@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Chaos/ChaosEngineInterface.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/HitResult.h"
+#include "State/ALSXTFootstepState.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ALSXTFootstepEffectsSubsystem.generated.h"
+
+class UALSXTFootstepEffectsSettings;
+class UALSXTSlideEffectsSettings;
+class UDecalComponent;
+class UMaterialInstanceDynamic;
+class UMaterialInterface;
+class USkeletalMeshComponent;
+struct FStreamableHandle;
+
+struct ALSXT_API FALSXTSurfaceTraceSettings
+{
+	TEnumAsByte<ETraceTypeQuery> TraceChannel{TraceTypeQuery1};
+
+	float TraceDistance{0.0f};
+
+	float CacheDistance{0.0f};
+
+	FVector FootYAxis{ForceInit};
+
+	FVector FootZAxis{ForceInit};
+};
+
+// The surface under a foot, with the transform effects are spawned at.
+struct ALSXT_API FALSXTResolvedSurface
+{
+	FName FootBoneName;
+
+	FTransform FootTransform;
+
+	float CapsuleScale{1.0f};
+
+	FHitResult Hit;
+
+	EPhysicalSurface SurfaceType{SurfaceType_Default};
+
+	FVector Location{ForceInit};
+
+	FQuat Rotation{ForceInit};
+};
+
+USTRUCT()
+struct ALSXT_API FALSXTPooledFootprintDecal
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UDecalComponent> Decal;
+
+	// A dynamic material instance can't change its parent, so one is kept per parent material used by the decal.
+	UPROPERTY()
+	TArray<TObjectPtr<UMaterialInstanceDynamic>> MaterialInstances;
+};
+
+// Resolves the surface under a foot and the effect settings of that surface for footstep and slide notifies,
+// reusing the last traced surface of ALSXT characters while they stand on the same floor.
+//
+// Keeps the assets of footstep and slide effects settings resident. The assets are requested asynchronously, either when
+// the world begins play for all settings loaded at that time, or when a settings asset is first used. Footstep
+// notifies never load assets themselves, they skip effects whose assets are not loaded yet.
+//
+// Also owns a fixed budget of footprint decals. Once the budget is reached, the oldest footprint is reused
+// instead of spawning a new decal component, and its material instances are reused along with it.
+
+UCLASS()
+class ALSXT_API UALSXTFootstepEffectsSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 FootprintDecalBudget{256};
+
+private:
+	TMap<TObjectKey<UObject>, TSharedPtr<FStreamableHandle>> PreloadHandles;
+
+	UPROPERTY()
+	TArray<FALSXTPooledFootprintDecal> FootprintDecals;
+
+	int32 NextFootprintDecalIndex{0};
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void OnWorldBeginPlay(UWorld& World) override;
+
+	virtual void Deinitialize() override;
+
+	// Does nothing if the assets of the settings were already requested.
+	void PreloadEffectsSettings(const UALSXTFootstepEffectsSettings* Settings);
+
+	void PreloadEffectsSettings(const UALSXTSlideEffectsSettings* Settings);
+
+	void ResolveSurface(const USkeletalMeshComponent& Mesh, EALSXTFootBone FootBone,
+	                    const FALSXTSurfaceTraceSettings& TraceSettings, FALSXTResolvedSurface& Surface) const;
+
+	// Resolves the surface under the foot and returns the effect settings of the surface, or null if there are none.
+	// Works with both footstep and slide effects settings.
+	template <typename EffectsSettingsType>
+	auto ResolveSurfaceEffect(const USkeletalMeshComponent& Mesh, EALSXTFootBone FootBone, const EffectsSettingsType& Settings,
+	                          FALSXTResolvedSurface& Surface);
+
+	template <typename EffectSettingsType, typename AllocatorType>
+	static void BuildEffectSettingsBySurface(const TMap<TEnumAsByte<EPhysicalSurface>, EffectSettingsType>& Effects,
+	                                         TArray<const EffectSettingsType*, AllocatorType>& EffectSettingsBySurface);
+
+	// Returns the decal and, if requested, its material instance of the material, ready for new parameters. Otherwise
+	// the decal uses the material itself, so no parameters of a previous use remain. The decal does not fade out
+	// until the caller sets it with SetFootprintDecalFadeOut(), otherwise it stays until it gets recycled.
+	UDecalComponent* SpawnFootprintDecal(UMaterialInterface* Material, const FVector& Size, USceneComponent* AttachComponent,
+	                                     const FVector& Location, const FRotator& Rotation, bool bCreateMaterialInstance,
+	                                     UMaterialInstanceDynamic*& MaterialInstance);
+
+	// Unlike UDecalComponent::SetFadeOut(), keeps the decal alive after it fades out so that it can be reused.
+	static void SetFootprintDecalFadeOut(UDecalComponent* Decal, float StartDelay, float Duration);
+
+private:
+	void PreloadEffectAssets(const UObject* Settings, TArray<FSoftObjectPath>&& AssetPaths);
+};
+
+template <typename EffectsSettingsType>
+auto UALSXTFootstepEffectsSubsystem::ResolveSurfaceEffect(const USkeletalMeshComponent& Mesh, const EALSXTFootBone FootBone,
+                                                          const EffectsSettingsType& Settings, FALSXTResolvedSurface& Surface)
+{
+	PreloadEffectsSettings(&Settings);
+
+	FALSXTSurfaceTraceSettings TraceSettings;
+	TraceSettings.TraceChannel = Settings.SurfaceTraceChannel;
+	TraceSettings.TraceDistance = Settings.SurfaceTraceDistance;
+	TraceSettings.CacheDistance = Settings.SurfaceCacheDistance;
+	TraceSettings.FootYAxis = FootBone == EALSXTFootBone::Left ? Settings.FootLeftYAxis : Settings.FootRightYAxis;
+	TraceSettings.FootZAxis = FootBone == EALSXTFootBone::Left ? Settings.FootLeftZAxis : Settings.FootRightZAxis;
+
+	ResolveSurface(Mesh, FootBone, TraceSettings, Surface);
+
+	return Settings.FindEffectSettings(Surface.SurfaceType);
+}
+
+template <typename EffectSettingsType, typename AllocatorType>
+void UALSXTFootstepEffectsSubsystem::BuildEffectSettingsBySurface(const TMap<TEnumAsByte<EPhysicalSurface>, EffectSettingsType>& Effects,
+                                                                  TArray<const EffectSettingsType*, AllocatorType>& EffectSettingsBySurface)
+{
+	const auto Iterator{Effects.CreateConstIterator()};
+	const auto* FallbackEffectSettings{Iterator ? &Iterator->Value : nullptr};
+
+	EffectSettingsBySurface.SetNumUninitialized(SurfaceType_Max);
+
+	for (auto i{0}; i < SurfaceType_Max; i++)
+	{
+		const auto* EffectSettings{Effects.Find(static_cast<EPhysicalSurface>(i))};
+		EffectSettingsBySurface[i] = EffectSettings != nullptr ? EffectSettings : FallbackEffectSettings;
+	}
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "ALSXTLagCompensationSubsystem.generated.h"
+
+class ACharacter;
+
+// Server side history of character capsules and physics asset bodies used to validate hits reported by remote clients
+// against where the target was at the time of the hit. The history of all characters is kept in flat arrays, indexed
+// by character slot and sample, so rewinding every character to a point in time is a linear pass.
+//
+// Bodies are recorded as bounding spheres around their bones, so that hits on extended limbs outside the capsule pass.
+// On dedicated servers the mesh must refresh its bones (VisibilityBasedAnimTickOption AlwaysTickPoseAndRefreshBones),
+// otherwise the bodies stay in the reference pose.
+//
+// Hits are reported by the client controlling the attacker, and the target is rewound by the ping of that client. The
+// time sent by the client is only used when it lies within that round trip, so a client can't rewind further than its
+// latency allows.
+// Targets without history, such as characters registered this frame, are validated against their current pose, and
+// hits older than the history fail validation.
+
+UCLASS()
+class ALSXT_API UALSXTLagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 HistorySize{32};
+
+	// Physics asset bodies recorded per character, the rest are only covered by the capsule.
+	static constexpr int32 MaxBodies{24};
+
+	// Hits older than this are not rewound and always fail validation.
+	static constexpr float MaxRewindTime{0.5f};
+
+	// Added to the round trip time of the client when checking the time it sent with the hit.
+	static constexpr float RewindTimeTolerance{0.05f};
+
+	// Added to the capsule radius and the body radii when testing hit locations.
+	static constexpr float HitTolerance{15.0f};
+
+	using FHitValidatedDelegate = TFunction<void(bool bValid)>;
+
+private:
+	struct FHitValidationRequest
+	{
+		TWeakObjectPtr<ACharacter> Target;
+
+		FVector HitLocation{ForceInit};
+
+		double Time{0.0};
+
+		FHitValidatedDelegate OnValidated;
+	};
+
+	// Per character slot.
+
+	TArray<TWeakObjectPtr<ACharacter>> Characters;
+
+	TArray<int32> FreeSlots;
+
+	// Shared by all characters, since they are sampled together.
+
+	double SampleTimes[HistorySize];
+
+	int32 SampleCount{0};
+
+	int32 HeadSampleIndex{INDEX_NONE};
+
+	// Per character slot and sample, at SlotIndex * HistorySize + SampleIndex.
+
+	TArray<FVector> CapsuleLocations;
+
+	TArray<FQuat4f> CapsuleRotations;
+
+	TArray<FVector2f> CapsuleSizes;
+
+	// Per character slot, the number of recorded bodies.
+
+	TArray<int32> BodyCounts;
+
+	// Per character slot and body, at SlotIndex * MaxBodies + BodyIndex.
+
+	// Resolved once on registration, so that recording reads the component space transforms by index.
+	TArray<int32> BodyBoneIndices;
+
+	TArray<FVector3f> BodyCenters;
+
+	TArray<float> BodyRadii;
+
+	// Per character slot, sample and body, at (SlotIndex * HistorySize + SampleIndex) * MaxBodies + BodyIndex.
+
+	TArray<FVector> BodyLocations;
+
+	// Per character slot, the result of the last rewind.
+
+	TArray<FVector> RewoundLocations;
+
+	TArray<FQuat4f> RewoundRotations;
+
+	TArray<FVector2f> RewoundSizes;
+
+	// Per character slot and body.
+
+	TArray<FVector> RewoundBodyLocations;
+
+	TArray<FHitValidationRequest> PendingRequests;
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual TStatId GetStatId() const override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	void RegisterCharacter(ACharacter* Character);
+
+	// Validated at the end of the frame, together with all other hits of the frame.
+	void RequestHitValidation(ACharacter* Target, const FVector& HitLocation, double Time, FHitValidatedDelegate&& OnValidated);
+
+	double GetServerTime() const;
+
+	// Returns the time to rewind to for a hit reported by the client controlling the attacker, with the time the client sent.
+	double GetRewindTime(const ACharacter& Attacker, double ClientTime) const;
+
+private:
+	void ProcessHitValidationRequests();
+
+	bool RewindCharacters(double Time);
+
+	void RewindCharacterToSample(int32 SlotIndex, int32 SampleIndex);
+
+	void RecordCharacters();
+
+	void RecordCharacter(const ACharacter& Character, int32 SlotIndex, int32 SampleIndex);
+
+	void InitializeBodies(const ACharacter& Character, int32 SlotIndex);
+
+	bool IsHitOnCharacter(int32 SlotIndex, const FVector& HitLocation) const;
+};
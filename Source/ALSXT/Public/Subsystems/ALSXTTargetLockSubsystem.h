@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "ALSXTTargetLockSubsystem.generated.h"
+
+// Registry of actors implementing IALSXTTargetLockInterface, bucketed into a coarse spatial grid so that
+// target lock candidates can be gathered without physics queries. The grid is rebuilt lazily, at most
+// once per grid refresh interval, since targets move. Targets are registered when they are spawned or their
+// level is added to the world, including streamed levels and world partition cells, and unregistered when
+// they are destroyed or their level is removed.
+
+UCLASS()
+class ALSXT_API UALSXTTargetLockSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr float GridCellSize{1000.0f};
+
+	static constexpr float GridRefreshInterval{0.1f};
+
+private:
+	TArray<TWeakObjectPtr<AActor>> Targets;
+
+	TMap<FIntVector, TArray<int32>> GridCells;
+
+	double GridRefreshTime{-1.0};
+
+	FDelegateHandle ActorSpawnedHandle;
+
+	FDelegateHandle ActorDestroyedHandle;
+
+	FDelegateHandle LevelAddedHandle;
+
+	FDelegateHandle LevelRemovedHandle;
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void OnWorldBeginPlay(UWorld& World) override;
+
+	virtual void Deinitialize() override;
+
+	void RegisterTarget(AActor* Actor);
+
+	void UnregisterTarget(AActor* Actor);
+
+	// Appends the registered targets whose location is within the radius.
+	void GatherTargets(const FVector& Location, float Radius, TArray<AActor*>& OutTargets);
+
+private:
+	void OnActorSpawned(AActor* Actor);
+
+	void OnActorDestroyed(AActor* Actor);
+
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
+	void RefreshGrid();
+
+	static FIntVector GetGridCell(const FVector& Location);
+};
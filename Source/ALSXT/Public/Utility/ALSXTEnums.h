@@ -10,4 +10,76 @@ enum class ETargetTraceDirection : uint8
 	Right	UMETA(DisplayName = "Right"),
 	Count UMETA(Hidden)
 };
-ENUM_RANGE_BY_COUNT(ETargetTraceDirection, ETargetTraceDirection::Count);
\ No newline at end of file
+ENUM_RANGE_BY_COUNT(ETargetTraceDirection, ETargetTraceDirection::Count);
+
+UENUM(BlueprintType)
+enum class EALSXTEffectSpawnType : uint8
+{
+	Footstep	UMETA(DisplayName = "Footstep"),
+	Slide	UMETA(DisplayName = "Slide"),
+	Breath	UMETA(DisplayName = "Breath"),
+	Count UMETA(Hidden)
+};
+ENUM_RANGE_BY_COUNT(EALSXTEffectSpawnType, EALSXTEffectSpawnType::Count);
+
+// Dense counterparts of gameplay tag families, in the declaration order of the tags.
+// See ALSXTGameplayTagEnumUtility for the conversions.
+
+UENUM(BlueprintType)
+enum class EALSXTGait : uint8
+{
+	Walking	UMETA(DisplayName = "Walking"),
+	Running	UMETA(DisplayName = "Running"),
+	Sprinting	UMETA(DisplayName = "Sprinting"),
+	Count UMETA(Hidden)
+};
+ENUM_RANGE_BY_COUNT(EALSXTGait, EALSXTGait::Count);
+
+UENUM(BlueprintType)
+enum class EALSXTImpactForm : uint8
+{
+	Push	UMETA(DisplayName = "Push"),
+	Blunt	UMETA(DisplayName = "Blunt"),
+	Blade	UMETA(DisplayName = "Blade"),
+	Bullet	UMETA(DisplayName = "Bullet"),
+	Explosion	UMETA(DisplayName = "Explosion"),
+	Electric	UMETA(DisplayName = "Electric"),
+	Count UMETA(Hidden)
+};
+ENUM_RANGE_BY_COUNT(EALSXTImpactForm, EALSXTImpactForm::Count);
+
+UENUM(BlueprintType)
+enum class EALSXTImpactSide : uint8
+{
+	Front	UMETA(DisplayName = "Front"),
+	Back	UMETA(DisplayName = "Back"),
+	Left	UMETA(DisplayName = "Left"),
+	Right	UMETA(DisplayName = "Right"),
+	High	UMETA(DisplayName = "High"),
+	Middle	UMETA(DisplayName = "Middle"),
+	Low	UMETA(DisplayName = "Low"),
+	Count UMETA(Hidden)
+};
+ENUM_RANGE_BY_COUNT(EALSXTImpactSide, EALSXTImpactSide::Count);
+
+UENUM(BlueprintType)
+enum class EALSXTActionStrength : uint8
+{
+	Light	UMETA(DisplayName = "Light"),
+	Medium	UMETA(DisplayName = "Medium"),
+	Heavy	UMETA(DisplayName = "Heavy"),
+	Count UMETA(Hidden)
+};
+ENUM_RANGE_BY_COUNT(EALSXTActionStrength, EALSXTActionStrength::Count);
+
+UENUM(BlueprintType)
+enum class EALSXTMeshPaintType : uint8
+{
+	BloodDamage	UMETA(DisplayName = "Blood Damage"),
+	SurfaceDamage	UMETA(DisplayName = "Surface Damage"),
+	BackSpatter	UMETA(DisplayName = "Back Spatter"),
+	Saturation	UMETA(DisplayName = "Saturation"),
+	Burn	UMETA(DisplayName = "Burn"),
+	Count UMETA(Hidden)
+};
+ENUM_RANGE_BY_COUNT(EALSXTMeshPaintType, EALSXTMeshPaintType::Count);
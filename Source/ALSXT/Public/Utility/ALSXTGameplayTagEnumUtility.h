@@ -0,0 +1,140 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/ALSXTEnums.h"
+#include "Utility/ALSXTGameplayTags.h"
+
+// Conversions between gameplay tag families and their dense enums in ALSXTEnums.h, so that hot paths can
+// switch on or index tables by an enum instead of comparing a tag against each tag of its family.
+
+template <typename EnumType>
+struct TALSXTGameplayTagEnumTraits;
+
+template <>
+struct TALSXTGameplayTagEnumTraits<EALSXTGait>
+{
+	static inline const FNativeGameplayTag* const Tags[]
+	{
+		&AlsGaitTags::Walking,
+		&AlsGaitTags::Running,
+		&AlsGaitTags::Sprinting
+	};
+};
+
+template <>
+struct TALSXTGameplayTagEnumTraits<EALSXTImpactForm>
+{
+	static inline const FNativeGameplayTag* const Tags[]
+	{
+		&ALSXTImpactFormTags::Push,
+		&ALSXTImpactFormTags::Blunt,
+		&ALSXTImpactFormTags::Blade,
+		&ALSXTImpactFormTags::Bullet,
+		&ALSXTImpactFormTags::Explosion,
+		&ALSXTImpactFormTags::Electric
+	};
+};
+
+template <>
+struct TALSXTGameplayTagEnumTraits<EALSXTImpactSide>
+{
+	static inline const FNativeGameplayTag* const Tags[]
+	{
+		&ALSXTImpactSideTags::Front,
+		&ALSXTImpactSideTags::Back,
+		&ALSXTImpactSideTags::Left,
+		&ALSXTImpactSideTags::Right,
+		&ALSXTImpactSideTags::Hight,
+		&ALSXTImpactSideTags::Middle,
+		&ALSXTImpactSideTags::Low
+	};
+};
+
+template <>
+struct TALSXTGameplayTagEnumTraits<EALSXTActionStrength>
+{
+	static inline const FNativeGameplayTag* const Tags[]
+	{
+		&ALSXTActionStrengthTags::Light,
+		&ALSXTActionStrengthTags::Medium,
+		&ALSXTActionStrengthTags::Heavy
+	};
+};
+
+template <>
+struct TALSXTGameplayTagEnumTraits<EALSXTMeshPaintType>
+{
+	static inline const FNativeGameplayTag* const Tags[]
+	{
+		&ALSXTMeshPaintTypeTags::BloodDamage,
+		&ALSXTMeshPaintTypeTags::SurfaceDamage,
+		&ALSXTMeshPaintTypeTags::BackSpatter,
+		&ALSXTMeshPaintTypeTags::Saturation,
+		&ALSXTMeshPaintTypeTags::Burn
+	};
+};
+
+namespace ALSXTGameplayTagEnumUtility
+{
+	template <typename EnumType>
+	const FGameplayTag& ToTag(EnumType Value);
+
+	// Returns EnumType::Count if the tag does not belong to the family of the enum. Families have only a few
+	// tags, so comparing the tags in order is faster than a hash lookup.
+	template <typename EnumType>
+	EnumType ToEnum(const FGameplayTag& Tag);
+
+	// Serializes a tag of the family of the enum as a single byte. Other tags, including the empty
+	// tag, follow an escape byte and are serialized in full, so any tag survives the round trip.
+	template <typename EnumType>
+	bool NetSerializeTag(FArchive& Archive, UPackageMap* Map, FGameplayTag& Tag);
+}
+
+template <typename EnumType>
+const FGameplayTag& ALSXTGameplayTagEnumUtility::ToTag(const EnumType Value)
+{
+	return Value < EnumType::Count
+		       ? TALSXTGameplayTagEnumTraits<EnumType>::Tags[static_cast<uint8>(Value)]->GetTag()
+		       : FGameplayTag::EmptyTag;
+}
+
+template <typename EnumType>
+EnumType ALSXTGameplayTagEnumUtility::ToEnum(const FGameplayTag& Tag)
+{
+	const auto& Tags{TALSXTGameplayTagEnumTraits<EnumType>::Tags};
+	static_assert(UE_ARRAY_COUNT(Tags) == static_cast<uint8>(EnumType::Count));
+
+	for (uint8 i{0}; i < static_cast<uint8>(EnumType::Count); i++)
+	{
+		if (Tags[i]->GetTag() == Tag)
+		{
+			return static_cast<EnumType>(i);
+		}
+	}
+
+	return EnumType::Count;
+}
+
+template <typename EnumType>
+bool ALSXTGameplayTagEnumUtility::NetSerializeTag(FArchive& Archive, UPackageMap* Map, FGameplayTag& Tag)
+{
+	auto Index{static_cast<uint8>(Archive.IsSaving() ? ToEnum<EnumType>(Tag) : EnumType::Count)};
+
+	Archive << Index;
+
+	if (Index < static_cast<uint8>(EnumType::Count))
+	{
+		if (Archive.IsLoading())
+		{
+			Tag = ToTag(static_cast<EnumType>(Index));
+		}
+
+		return true;
+	}
+
+	auto bSuccess{true};
+	Tag.NetSerialize(Archive, Map, bSuccess);
+
+	return bSuccess;
+}
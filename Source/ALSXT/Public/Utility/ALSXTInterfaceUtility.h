@@ -0,0 +1,56 @@
+#pragma once
+
+#include "UObject/Object.h"
+
+namespace ALSXTInterfaceUtility
+{
+	// Whether the class overrides or implements the interface function in Blueprint.
+	ALSXT_API bool IsFunctionImplementedInBlueprint(const UClass& Class, FName FunctionName);
+
+	template <typename InterfaceType>
+	bool IsImplementedNatively(const UObject* Object, FName FunctionName);
+
+	// Calls NativeFunction on the object when the object implements the interface in C++ and the function is not
+	// implemented in Blueprint, and ExecuteFunction, the Execute_ wrapper of the function, otherwise. NativeFunction
+	// is either the _Implementation of a BlueprintNativeEvent, or the native counterpart of a BlueprintImplementableEvent.
+	template <typename InterfaceType, typename NativeFunctionType, typename ExecuteFunctionType, typename... ArgumentTypes>
+	decltype(auto) Execute(UObject* Object, FName FunctionName, NativeFunctionType NativeFunction,
+	                       ExecuteFunctionType ExecuteFunction, ArgumentTypes&&... Arguments);
+}
+
+template <typename InterfaceType>
+bool ALSXTInterfaceUtility::IsImplementedNatively(const UObject* Object, const FName FunctionName)
+{
+	// Interfaces implemented in Blueprint can't be cast to.
+
+	return IsValid(Object) && Cast<InterfaceType>(Object) != nullptr &&
+	       !IsFunctionImplementedInBlueprint(*Object->GetClass(), FunctionName);
+}
+
+template <typename InterfaceType, typename NativeFunctionType, typename ExecuteFunctionType, typename... ArgumentTypes>
+decltype(auto) ALSXTInterfaceUtility::Execute(UObject* Object, const FName FunctionName, const NativeFunctionType NativeFunction,
+                                              const ExecuteFunctionType ExecuteFunction, ArgumentTypes&&... Arguments)
+{
+	auto* Interface{IsValid(Object) ? Cast<InterfaceType>(Object) : nullptr};
+
+	if (Interface != nullptr && !IsFunctionImplementedInBlueprint(*Object->GetClass(), FunctionName))
+	{
+		return (Interface->*NativeFunction)(Forward<ArgumentTypes>(Arguments)...);
+	}
+
+	return ExecuteFunction(Object, Forward<ArgumentTypes>(Arguments)...);
+}
+
+// Only paste the function names for ALSXTInterfaceUtility::Execute(), every argument is evaluated once.
+
+// For BlueprintNativeEvent functions, calls their _Implementation.
+#define ALSXT_EXECUTE(InterfaceType, FunctionName, Object, ...) \
+	ALSXTInterfaceUtility::Execute<InterfaceType>(Object, GET_FUNCTION_NAME_CHECKED(InterfaceType, FunctionName), \
+	                                              &InterfaceType::FunctionName##_Implementation, \
+	                                              &InterfaceType::Execute_##FunctionName, ##__VA_ARGS__)
+
+// For BlueprintImplementableEvent functions with a native counterpart prefixed with Native, calls the counterpart.
+#define ALSXT_EXECUTE_NATIVE(InterfaceType, FunctionName, Object, ...) \
+	ALSXTInterfaceUtility::Execute<InterfaceType>(Object, GET_FUNCTION_NAME_CHECKED(InterfaceType, FunctionName), \
+	                                              &InterfaceType::Native##FunctionName, \
+	                                              &InterfaceType::Execute_##FunctionName, ##__VA_ARGS__)
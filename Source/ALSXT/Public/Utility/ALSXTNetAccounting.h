@@ -0,0 +1,38 @@
+#pragma once
+
+#include "UObject/CoreNet.h"
+#include "ALSXTNetAccounting.generated.h"
+
+// Console toggled accounting of the bits sent for ALSXT replicated properties and RPCs. While alsxt.Net.Accounting
+// is enabled, each ALSXT property that changed since the previous replication of its object is serialized as it would
+// be sent, and so is each RPC as it is called, and the bits are attributed to the property or RPC. alsxt.Net.DumpReport
+// logs the entries sorted by cost, in bytes per character per second, and flags when the total is over the
+// alsxt.Net.CharacterBudget. Only payloads are accounted, property handles and bunch headers are not included.
+
+// Writes a packed stand-in for the object's net GUID instead of mapping the object, so that accounting never
+// assigns net GUIDs or queues exports on a real package map.
+
+UCLASS(Transient)
+class ALSXT_API UALSXTNetAccountingPackageMap : public UPackageMap
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool SerializeObject(FArchive& Archive, UClass* Class, UObject*& Object, FNetworkGUID* OutNetGuid = nullptr) override;
+};
+
+namespace ALSXTNetAccounting
+{
+	ALSXT_API bool IsEnabled();
+
+	// Called on the server before the object is replicated.
+	ALSXT_API void RecordReplicatedProperties(const UObject& Object);
+
+	// Called on the sending side with the parameters of the RPC. Only RPCs declared by ALSXT classes are accounted.
+	ALSXT_API void RecordRpc(const UObject& Object, const UFunction& Function, void* Parameters);
+
+	// Returns false if the total is over the character budget.
+	ALSXT_API bool DumpReport();
+
+	ALSXT_API void ResetReport();
+}
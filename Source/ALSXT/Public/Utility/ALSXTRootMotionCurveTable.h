@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCurveFloat;
+class UCurveVector;
+
+// Uniformly sampled copy of an action montage's blend in and interpolation and correction amounts curves, together
+// with the play rate and start time mapped for the action height. Baked once when a root motion source is created,
+// so that simulation steps only do a clamped table lookup instead of evaluating curve assets.
+
+class ALSXT_API FALSXTRootMotionCurveTable
+{
+public:
+	static constexpr int32 SampleCount{64};
+
+	float PlayRate{1.0f};
+
+	float StartTime{0.0f};
+
+private:
+	float BlendInMinTime{0.0f};
+
+	float BlendInSampleRate{0.0f};
+
+	float InterpolationAndCorrectionMinTime{0.0f};
+
+	float InterpolationAndCorrectionSampleRate{0.0f};
+
+	float BlendInAmounts[SampleCount];
+
+	FVector3f InterpolationAndCorrectionAmounts[SampleCount];
+
+public:
+	FALSXTRootMotionCurveTable();
+
+	void Bake(const UCurveFloat* BlendInCurve, const UCurveVector* InterpolationAndCorrectionAmountsCurve,
+	          float NewPlayRate, float NewStartTime);
+
+	float GetBlendInAmount(float ActionTime) const;
+
+	FVector3f GetInterpolationAndCorrectionAmounts(float ActionTime) const;
+
+private:
+	static void GetSampleIndexAndAlpha(float Time, float MinTime, float SampleRate, int32& Index, float& Alpha);
+};
+
+inline void FALSXTRootMotionCurveTable::GetSampleIndexAndAlpha(const float Time, const float MinTime, const float SampleRate,
+                                                              int32& Index, float& Alpha)
+{
+	const auto SamplePosition{FMath::Clamp((Time - MinTime) * SampleRate, 0.0f, static_cast<float>(SampleCount - 1))};
+
+	Index = FMath::Min(FMath::FloorToInt32(SamplePosition), SampleCount - 2);
+	Alpha = SamplePosition - static_cast<float>(Index);
+}
+
+inline float FALSXTRootMotionCurveTable::GetBlendInAmount(const float ActionTime) const
+{
+	int32 Index;
+	float Alpha;
+	GetSampleIndexAndAlpha(ActionTime, BlendInMinTime, BlendInSampleRate, Index, Alpha);
+
+	return FMath::Lerp(BlendInAmounts[Index], BlendInAmounts[Index + 1], Alpha);
+}
+
+inline FVector3f FALSXTRootMotionCurveTable::GetInterpolationAndCorrectionAmounts(const float ActionTime) const
+{
+	int32 Index;
+	float Alpha;
+	GetSampleIndexAndAlpha(ActionTime + StartTime, InterpolationAndCorrectionMinTime, InterpolationAndCorrectionSampleRate, Index, Alpha);
+
+	return FMath::Lerp(InterpolationAndCorrectionAmounts[Index], InterpolationAndCorrectionAmounts[Index + 1], Alpha);
+}
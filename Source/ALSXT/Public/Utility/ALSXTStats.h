@@ -0,0 +1,150 @@
+#pragma once
+
+#include <atomic>
+
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+class AActor;
+
+DECLARE_STATS_GROUP(TEXT("ALSXT"), STATGROUP_ALSXT, STATCAT_Advanced);
+
+// Every ALSXT stat is paired with a benchmark counter, which unlike the stat is kept in every build configuration. The
+// counters only accumulate while enabled, so that the benchmark subsystem can sample them in a test or shipping build.
+
+#define ALSXT_DECLARE_CYCLE_STAT(Name, Stat) \
+	DECLARE_CYCLE_STAT_EXTERN(Name, Stat, STATGROUP_ALSXT, ALSXT_API); \
+	extern ALSXT_API ALSXTStats::FBenchmarkCounter Stat##_BenchmarkCounter
+
+#define ALSXT_DECLARE_DWORD_COUNTER_STAT(Name, Stat) \
+	DECLARE_DWORD_COUNTER_STAT_EXTERN(Name, Stat, STATGROUP_ALSXT, ALSXT_API); \
+	extern ALSXT_API ALSXTStats::FBenchmarkCounter Stat##_BenchmarkCounter
+
+#define ALSXT_DEFINE_STAT(Stat, bCycles) \
+	DEFINE_STAT(Stat); \
+	ALSXTStats::FBenchmarkCounter Stat##_BenchmarkCounter{TEXT(#Stat), bCycles}
+
+namespace ALSXTStats
+{
+	class ALSXT_API FBenchmarkCounter
+	{
+	private:
+		const TCHAR* Name;
+
+		std::atomic<uint64> Value{0};
+
+		bool bCycles;
+
+	public:
+		FBenchmarkCounter(const TCHAR* Name, bool bCycles);
+
+		const TCHAR* GetName() const;
+
+		// Cycles64 for cycle stats, the count for counter stats.
+		uint64 GetValue() const;
+
+		bool IsCycles() const;
+
+		void Add(uint64 Amount);
+	};
+
+	class FScopeBenchmarkCounter
+	{
+	private:
+		FBenchmarkCounter* Counter;
+
+		uint64 StartCycles{0};
+
+	public:
+		explicit FScopeBenchmarkCounter(FBenchmarkCounter& Counter);
+
+		~FScopeBenchmarkCounter();
+	};
+
+	extern ALSXT_API bool bBenchmarkCountersEnabled;
+
+	ALSXT_API const TArray<FBenchmarkCounter*>& GetBenchmarkCounters();
+}
+
+ALSXT_DECLARE_CYCLE_STAT(TEXT("Obstacle Trace"), STAT_ALSXT_ObstacleTrace);
+ALSXT_DECLARE_CYCLE_STAT(TEXT("Anticipation Trace"), STAT_ALSXT_AnticipationTrace);
+ALSXT_DECLARE_CYCLE_STAT(TEXT("Attack Collision Trace"), STAT_ALSXT_AttackCollisionTrace);
+ALSXT_DECLARE_CYCLE_STAT(TEXT("Try Start Vaulting"), STAT_ALSXT_TryStartVaulting);
+ALSXT_DECLARE_CYCLE_STAT(TEXT("Sound Selection"), STAT_ALSXT_SoundSelection);
+ALSXT_DECLARE_CYCLE_STAT(TEXT("Mesh Painting"), STAT_ALSXT_MeshPainting);
+ALSXT_DECLARE_CYCLE_STAT(TEXT("Footstep Notify"), STAT_ALSXT_FootstepNotify);
+ALSXT_DECLARE_CYCLE_STAT(TEXT("Effect Notify"), STAT_ALSXT_EffectNotify);
+
+ALSXT_DECLARE_DWORD_COUNTER_STAT(TEXT("Traces"), STAT_ALSXT_Traces);
+ALSXT_DECLARE_DWORD_COUNTER_STAT(TEXT("Effects Spawned"), STAT_ALSXT_EffectsSpawned);
+ALSXT_DECLARE_DWORD_COUNTER_STAT(TEXT("RPCs Sent"), STAT_ALSXT_RpcsSent);
+
+// An estimate only: the size of the parameters of the sent RPCs in memory, not the bits written to the wire. Enable
+// alsxt.Net.Accounting for the serialized size of each RPC.
+ALSXT_DECLARE_DWORD_COUNTER_STAT(TEXT("RPC Parameter Bytes (In Memory Estimate)"), STAT_ALSXT_RpcParameterBytesEstimate);
+
+// Enabled with -trace=cpu,ALSXT. Nests an event named after the character under each scoped
+// ALSXT stat, so that a capture attributes the ALSXT cost to individual characters.
+UE_TRACE_CHANNEL_EXTERN(ALSXTChannel, ALSXT_API);
+
+namespace ALSXTStats
+{
+	// Empty unless the ALSXT trace channel is enabled, so that the name is only built when it is traced.
+	ALSXT_API FString GetTraceEventName(const AActor* Actor);
+
+	// Only counts the RPCs declared by ALSXT classes.
+	ALSXT_API void RecordRpc(const UFunction* Function);
+}
+
+#define ALSXT_SCOPE_CYCLE_COUNTER(Stat, Actor) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	const ALSXTStats::FScopeBenchmarkCounter PREPROCESSOR_JOIN(ScopeBenchmarkCounter, __LINE__){Stat##_BenchmarkCounter}; \
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*ALSXTStats::GetTraceEventName(Actor), ALSXTChannel)
+
+#define ALSXT_INC_DWORD_STAT_BY(Stat, Amount) \
+	INC_DWORD_STAT_BY(Stat, Amount); \
+	Stat##_BenchmarkCounter.Add(Amount)
+
+#define ALSXT_INC_DWORD_STAT(Stat) \
+	ALSXT_INC_DWORD_STAT_BY(Stat, 1)
+
+inline const TCHAR* ALSXTStats::FBenchmarkCounter::GetName() const
+{
+	return Name;
+}
+
+inline uint64 ALSXTStats::FBenchmarkCounter::GetValue() const
+{
+	return Value.load(std::memory_order_relaxed);
+}
+
+inline bool ALSXTStats::FBenchmarkCounter::IsCycles() const
+{
+	return bCycles;
+}
+
+inline void ALSXTStats::FBenchmarkCounter::Add(const uint64 Amount)
+{
+	if (bBenchmarkCountersEnabled)
+	{
+		Value.fetch_add(Amount, std::memory_order_relaxed);
+	}
+}
+
+inline ALSXTStats::FScopeBenchmarkCounter::FScopeBenchmarkCounter(FBenchmarkCounter& Counter)
+	: Counter{bBenchmarkCountersEnabled ? &Counter : nullptr}
+{
+	if (this->Counter != nullptr)
+	{
+		StartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+inline ALSXTStats::FScopeBenchmarkCounter::~FScopeBenchmarkCounter()
+{
+	if (Counter != nullptr)
+	{
+		Counter->Add(FPlatformTime::Cycles64() - StartCycles);
+	}
+}
@@ -182,6 +182,16 @@ struct ALSXT_API FExtendedHitResult
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
 	FHitResult HitResult;
 
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FExtendedHitResult> : public TStructOpsTypeTraitsBase2<FExtendedHitResult>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 USTRUCT(BlueprintType)
@@ -213,6 +223,16 @@ struct ALSXT_API FDoubleHitResult
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
 	FExtendedHitResult OriginHitResult;
 
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FDoubleHitResult> : public TStructOpsTypeTraitsBase2<FDoubleHitResult>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 USTRUCT(BlueprintType)
@@ -235,6 +255,20 @@ struct ALSXT_API FAttackDoubleHitResult
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
 	FDoubleHitResult DoubleHitResult;
 
+	// Server world time at which the hit was traced, used by the server to rewind the target when validating it.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
+	double TimeStamp{ 0.0 };
+
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAttackDoubleHitResult> : public TStructOpsTypeTraitsBase2<FAttackDoubleHitResult>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 USTRUCT(BlueprintType)